@@ -0,0 +1,129 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+#include <alsactl.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+// Measure the cost to enumerate the identifiers of elements in the sound card with a large set of
+// user-defined elements, by the list and by the array. The numeric identifier of sound card is
+// given by the first argument, or zero as default.
+
+#define USER_ELEM_COUNT     4000
+#define ITERATION_COUNT     100
+
+static void free_elem_id(gpointer data)
+{
+    g_boxed_free(ALSACTL_TYPE_ELEM_ID, data);
+}
+
+static gboolean enumerate_by_list(ALSACtlCard *card, gsize *count, gint64 *elapsed,
+                                  GError **error)
+{
+    gint64 begin;
+    guint i;
+
+    begin = g_get_monotonic_time();
+
+    for (i = 0; i < ITERATION_COUNT; ++i) {
+        GList *entries = NULL;
+
+        if (!alsactl_card_get_elem_id_list(card, &entries, error))
+            return FALSE;
+
+        *count = g_list_length(entries);
+        g_list_free_full(entries, free_elem_id);
+    }
+
+    *elapsed = g_get_monotonic_time() - begin;
+
+    return TRUE;
+}
+
+static gboolean enumerate_by_array(ALSACtlCard *card, gsize *count, gint64 *elapsed,
+                                   GError **error)
+{
+    gint64 begin;
+    guint i;
+
+    begin = g_get_monotonic_time();
+
+    for (i = 0; i < ITERATION_COUNT; ++i) {
+        ALSACtlElemId *entries;
+
+        if (!alsactl_card_get_elem_id_array(card, &entries, count, error))
+            return FALSE;
+
+        g_free(entries);
+    }
+
+    *elapsed = g_get_monotonic_time() - begin;
+
+    return TRUE;
+}
+
+static void print_result(const char *label, gsize count, gint64 elapsed)
+{
+    printf("%-6s %6zu entries, %10" G_GINT64_FORMAT " usec total, %10.3f usec/call\n",
+           label, count, elapsed, (double)elapsed / ITERATION_COUNT);
+}
+
+int main(int argc, char **argv)
+{
+    ALSACtlCard *card;
+    ALSACtlElemInfoBoolean *elem_info;
+    ALSACtlElemId *elem_id;
+    GList *entries = NULL;
+    guint card_id = 0;
+    gsize count;
+    gint64 elapsed;
+    GError *error = NULL;
+    int status = EXIT_FAILURE;
+
+    if (argc > 1)
+        card_id = strtoul(argv[1], NULL, 10);
+
+    card = alsactl_card_new();
+    if (!alsactl_card_open(card, card_id, 0, &error))
+        goto end_card;
+
+    elem_info = alsactl_elem_info_boolean_new();
+    g_object_set(elem_info,
+                 "access", ALSACTL_ELEM_ACCESS_FLAG_READ | ALSACTL_ELEM_ACCESS_FLAG_WRITE,
+                 "value-count", 1,
+                 NULL);
+
+    elem_id = alsactl_elem_id_new_by_name(ALSACTL_ELEM_IFACE_TYPE_MIXER, 0, 0,
+                                          "alsa-gobject-benchmark", 0);
+    if (!alsactl_card_add_elems(card, elem_id, USER_ELEM_COUNT,
+                                ALSACTL_ELEM_INFO_COMMON(elem_info), &entries, &error))
+        goto end_elem;
+
+    printf("%d iterations with %d user-defined elements\n", ITERATION_COUNT, USER_ELEM_COUNT);
+
+    if (!enumerate_by_list(card, &count, &elapsed, &error))
+        goto end_user_elems;
+    print_result("list", count, elapsed);
+
+    if (!enumerate_by_array(card, &count, &elapsed, &error))
+        goto end_user_elems;
+    print_result("array", count, elapsed);
+
+    status = EXIT_SUCCESS;
+end_user_elems:
+    // NOTE: The set of user-defined elements is removed at once by any identifier in it.
+    if (!alsactl_card_remove_elems(card, entries->data, error != NULL ? NULL : &error))
+        status = EXIT_FAILURE;
+    g_list_free_full(entries, free_elem_id);
+end_elem:
+    g_boxed_free(ALSACTL_TYPE_ELEM_ID, elem_id);
+    g_object_unref(elem_info);
+end_card:
+    g_object_unref(card);
+
+    if (error != NULL) {
+        fprintf(stderr, "%s\n", error->message);
+        g_clear_error(&error);
+    }
+
+    return status;
+}
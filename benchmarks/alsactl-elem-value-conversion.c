@@ -0,0 +1,79 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+#include <alsactl.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+// Measure the cost to convert values of boolean and integer element between the internal storage
+// of long type and the array of 32 bit type. Each iteration changes the storage, then retrieves
+// the converted array, as the read of value from the element does.
+
+#define ITERATION_COUNT     1000000
+
+static const gsize value_counts[] = { 1, 2, 8, 32, 128 };
+
+static gint64 convert_bool(ALSACtlElemValue *elem_value, const gboolean *values, gsize count)
+{
+    const gboolean *converted;
+    gint64 begin;
+    guint i;
+
+    begin = g_get_monotonic_time();
+
+    for (i = 0; i < ITERATION_COUNT; ++i) {
+        alsactl_elem_value_set_bool(elem_value, values, count);
+        alsactl_elem_value_get_bool(elem_value, &converted);
+    }
+
+    return g_get_monotonic_time() - begin;
+}
+
+static gint64 convert_int(ALSACtlElemValue *elem_value, const gint32 *values, gsize count)
+{
+    const gint32 *converted;
+    gint64 begin;
+    guint i;
+
+    begin = g_get_monotonic_time();
+
+    for (i = 0; i < ITERATION_COUNT; ++i) {
+        alsactl_elem_value_set_int(elem_value, values, count);
+        alsactl_elem_value_get_int(elem_value, &converted);
+    }
+
+    return g_get_monotonic_time() - begin;
+}
+
+static void print_result(const char *label, gsize count, gint64 elapsed)
+{
+    printf("%-4s %3zu values, %10" G_GINT64_FORMAT " usec total, %8.3f nsec/iteration\n",
+           label, count, elapsed, (double)elapsed * 1000 / ITERATION_COUNT);
+}
+
+int main(void)
+{
+    ALSACtlElemValue *elem_value;
+    gboolean booleans[128];
+    gint32 integers[128];
+    int i;
+
+    for (i = 0; i < G_N_ELEMENTS(integers); ++i) {
+        booleans[i] = i % 2;
+        integers[i] = (i % 2) ? -i : i;
+    }
+
+    elem_value = alsactl_elem_value_new();
+
+    printf("%d iterations\n", ITERATION_COUNT);
+
+    for (i = 0; i < G_N_ELEMENTS(value_counts); ++i) {
+        gsize count = value_counts[i];
+
+        print_result("bool", count, convert_bool(elem_value, booleans, count));
+        print_result("int", count, convert_int(elem_value, integers, count));
+    }
+
+    g_object_unref(elem_value);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,173 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+#include <alsaseq.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+// Measure the cost to handle a batch of events by signal emission and by the function installed
+// by alsaseq_user_client_set_event_handler(). The client delivers the batch to its own port
+// directly, then the source dispatches it.
+
+#define BATCH_EVENT_COUNT   64
+#define ITERATION_COUNT     10000
+
+static gsize count_events(ALSASeqEventCntr *ev_cntr)
+{
+    ALSASeqEventCntrIter iter;
+    const ALSASeqEvent *ev;
+    gsize count = 0;
+
+    alsaseq_event_cntr_iter_init(&iter, ev_cntr);
+    while (alsaseq_event_cntr_iter_next(&iter, &ev))
+        ++count;
+
+    return count;
+}
+
+static void handle_event_signal(ALSASeqUserClient *client, const ALSASeqEventCntr *ev_cntr,
+                                gpointer user_data)
+{
+    gsize *received = user_data;
+
+    // NOTE: The container is a copy owned by the signal emission.
+    *received += count_events((ALSASeqEventCntr *)ev_cntr);
+}
+
+static void handle_event_func(ALSASeqUserClient *client, ALSASeqEventCntr *ev_cntr,
+                              gpointer user_data)
+{
+    gsize *received = user_data;
+
+    *received += count_events(ev_cntr);
+}
+
+static gboolean run_iterations(ALSASeqUserClient *client, GMainContext *ctx,
+                               const ALSASeqEventCntr *ev_cntr, gsize *received,
+                               gint64 *elapsed, GError **error)
+{
+    gint64 begin;
+    guint i;
+
+    begin = g_get_monotonic_time();
+
+    for (i = 0; i < ITERATION_COUNT; ++i) {
+        gsize count;
+
+        *received = 0;
+        if (!alsaseq_user_client_schedule_event_cntr(client, ev_cntr, &count, error))
+            return FALSE;
+
+        while (*received < count)
+            g_main_context_iteration(ctx, TRUE);
+    }
+
+    *elapsed = g_get_monotonic_time() - begin;
+
+    return TRUE;
+}
+
+static ALSASeqEventCntr *prepare_events(guint8 client_id, guint8 port_id)
+{
+    ALSASeqEventCntr *ev_cntr;
+    ALSASeqAddr *addr;
+    guint i;
+
+    ev_cntr = alsaseq_event_cntr_new(BATCH_EVENT_COUNT);
+    addr = alsaseq_addr_new(client_id, port_id);
+
+    for (i = 0; i < BATCH_EVENT_COUNT; ++i) {
+        ALSASeqEvent *ev = alsaseq_event_new(ALSASEQ_EVENT_TYPE_CONTROLLER);
+
+        alsaseq_event_set_source(ev, addr);
+        alsaseq_event_set_destination(ev, addr);
+        alsaseq_event_set_queue_id(ev, ALSASEQ_SPECIFIC_QUEUE_ID_DIRECT);
+        alsaseq_event_cntr_append_event(ev_cntr, ev);
+
+        g_boxed_free(ALSASEQ_TYPE_EVENT, ev);
+    }
+
+    g_boxed_free(ALSASEQ_TYPE_ADDR, addr);
+
+    return ev_cntr;
+}
+
+static void print_result(const char *label, gint64 elapsed)
+{
+    printf("%-10s %10" G_GINT64_FORMAT " usec total, %8.3f usec/batch, %8.3f usec/event\n",
+           label, elapsed, (double)elapsed / ITERATION_COUNT,
+           (double)elapsed / ITERATION_COUNT / BATCH_EVENT_COUNT);
+}
+
+int main(void)
+{
+    ALSASeqUserClient *client;
+    ALSASeqPortInfo *port_info;
+    ALSASeqAddr *port_addr;
+    ALSASeqEventCntr *ev_cntr;
+    GMainContext *ctx;
+    GSource *src;
+    guint8 client_id;
+    guint8 port_id;
+    gsize received;
+    gint64 elapsed;
+    gulong handler_id;
+    GError *error = NULL;
+    int status = EXIT_FAILURE;
+
+    client = alsaseq_user_client_new();
+    if (!alsaseq_user_client_open(client, 0, &error))
+        goto end_client;
+    g_object_get(client, "client-id", &client_id, NULL);
+
+    port_info = alsaseq_port_info_new();
+    g_object_set(port_info,
+                 "name", "benchmark",
+                 "caps", ALSASEQ_PORT_CAP_FLAG_WRITE,
+                 "attrs", ALSASEQ_PORT_ATTR_FLAG_APPLICATION,
+                 NULL);
+    if (!alsaseq_user_client_create_port(client, &port_info, &error))
+        goto end_port;
+    g_object_get(port_info, "addr", &port_addr, NULL);
+    alsaseq_addr_get_port_id(port_addr, &port_id);
+    g_boxed_free(ALSASEQ_TYPE_ADDR, port_addr);
+
+    if (!alsaseq_user_client_create_source(client, &src, &error))
+        goto end_port;
+    ctx = g_main_context_new();
+    g_source_attach(src, ctx);
+
+    ev_cntr = prepare_events(client_id, port_id);
+
+    printf("%d iterations of batch with %d events\n", ITERATION_COUNT, BATCH_EVENT_COUNT);
+
+    handler_id = g_signal_connect(client, "handle-event", G_CALLBACK(handle_event_signal),
+                                  &received);
+    if (!run_iterations(client, ctx, ev_cntr, &received, &elapsed, &error))
+        goto end_source;
+    g_signal_handler_disconnect(client, handler_id);
+    print_result("signal", elapsed);
+
+    alsaseq_user_client_set_event_handler(client, handle_event_func, &received, NULL);
+    if (!run_iterations(client, ctx, ev_cntr, &received, &elapsed, &error))
+        goto end_source;
+    alsaseq_user_client_set_event_handler(client, NULL, NULL, NULL);
+    print_result("handler", elapsed);
+
+    status = EXIT_SUCCESS;
+end_source:
+    g_boxed_free(ALSASEQ_TYPE_EVENT_CNTR, ev_cntr);
+    g_source_destroy(src);
+    g_source_unref(src);
+    g_main_context_unref(ctx);
+end_port:
+    g_object_unref(port_info);
+end_client:
+    g_object_unref(client);
+
+    if (error != NULL) {
+        fprintf(stderr, "%s\n", error->message);
+        g_clear_error(&error);
+    }
+
+    return status;
+}
@@ -25,6 +25,7 @@
 #include <elem-info-integer64.h>
 #include <elem-info-enumerated.h>
 #include <elem-value.h>
+#include <compact-elem-value.h>
 #include <card.h>
 
 #include <query.h>
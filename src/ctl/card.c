@@ -25,6 +25,33 @@ typedef struct {
     char *devnode;
     gint subscribers;
     guint16 proto_ver_triplet[3];
+
+    GMutex cache_lock;
+    gboolean elem_info_cache;
+    GHashTable *cached_elem_infos;
+    GHashTable *cached_enum_labels;
+    guint cache_generation;
+
+    GMutex mirror_write_lock;
+    struct elem_value_mirror *value_mirror;
+    gint mirror_readers;
+    gsize mirror_stamp;
+
+    gboolean coalesce_elem_events;
+    guint64 received_elem_event_count;
+    guint64 coalesced_elem_event_count;
+
+    GMutex write_lock;
+    GRecMutex flush_lock;
+    GQueue pending_writes;
+    GHashTable *pending_write_table;
+    GSource *write_src;
+
+    GMutex name_index_lock;
+    GHashTable *name_index;
+
+    GMutex worker_pool_lock;
+    GThreadPool *worker_pool;
 } ALSACtlCardPrivate;
 G_DEFINE_TYPE_WITH_PRIVATE(ALSACtlCard, alsactl_card, G_TYPE_OBJECT)
 
@@ -60,9 +87,30 @@ typedef struct {
     unsigned int buf_len;
 } CtlCardSource;
 
+typedef struct {
+    GSource src;
+    ALSACtlCard *self;
+    gint64 interval;
+    gint64 last_flush;
+} CtlCardWriteSource;
+
+struct cached_enum_labels {
+    struct ctl_elem_enum_labels *labels;
+    guint entry_count;
+};
+
+struct cached_elem_info {
+    struct snd_ctl_elem_info data;
+    struct cached_enum_labels *labels;
+};
+
 enum ctl_card_prop_type {
     CTL_CARD_PROP_DEVNODE = 1,
     CTL_CARD_PROP_SUBSCRIBED,
+    CTL_CARD_PROP_ELEM_INFO_CACHE,
+    CTL_CARD_PROP_COALESCE_ELEM_EVENTS,
+    CTL_CARD_PROP_RECEIVED_ELEM_EVENT_COUNT,
+    CTL_CARD_PROP_COALESCED_ELEM_EVENT_COUNT,
     CTL_CARD_PROP_COUNT,
 };
 static GParamSpec *ctl_card_props[CTL_CARD_PROP_COUNT] = { NULL, };
@@ -70,10 +118,104 @@ static GParamSpec *ctl_card_props[CTL_CARD_PROP_COUNT] = { NULL, };
 enum ctl_card_sig_type {
     CTL_CARD_SIG_HANDLE_ELEM_EVENT = 0,
     CTL_CARD_SIG_HANDLE_DISCONNECTION,
+    CTL_CARD_SIG_HANDLE_ELEM_WRITE,
     CTL_CARD_SIG_COUNT,
 };
 static guint ctl_card_sigs[CTL_CARD_SIG_COUNT] = { 0 };
 
+static guint enum_labels_hash(gconstpointer key)
+{
+    const gchar *const *labels = key;
+    guint hash = 0;
+
+    while (*labels != NULL) {
+        hash = hash * 31 + g_str_hash(*labels);
+        ++labels;
+    }
+
+    return hash;
+}
+
+static gboolean enum_labels_equal(gconstpointer a, gconstpointer b)
+{
+    const gchar *const *lhs = a;
+    const gchar *const *rhs = b;
+
+    while (*lhs != NULL && *rhs != NULL) {
+        if (!g_str_equal(*lhs, *rhs))
+            return FALSE;
+        ++lhs;
+        ++rhs;
+    }
+
+    return *lhs == NULL && *rhs == NULL;
+}
+
+static void free_cached_enum_labels(gpointer data)
+{
+    struct cached_enum_labels *entry = data;
+
+    ctl_elem_enum_labels_unref(entry->labels);
+    g_free(entry);
+}
+
+// The lock should be acquired by caller.
+static void drop_cached_elem_info(ALSACtlCardPrivate *priv, guint numid)
+{
+    struct cached_elem_info *entry;
+
+    if (priv->cached_elem_infos == NULL)
+        return;
+
+    entry = g_hash_table_lookup(priv->cached_elem_infos, GUINT_TO_POINTER(numid));
+    if (entry == NULL)
+        return;
+
+    if (entry->labels != NULL && --entry->labels->entry_count == 0)
+        g_hash_table_remove(priv->cached_enum_labels, entry->labels->labels->labels);
+
+    g_hash_table_remove(priv->cached_elem_infos, GUINT_TO_POINTER(numid));
+}
+
+// The lock should be acquired by caller.
+static void drop_all_cached_elem_infos(ALSACtlCardPrivate *priv)
+{
+    ++priv->cache_generation;
+
+    if (priv->cached_elem_infos != NULL) {
+        g_hash_table_destroy(priv->cached_elem_infos);
+        priv->cached_elem_infos = NULL;
+    }
+
+    if (priv->cached_enum_labels != NULL) {
+        g_hash_table_destroy(priv->cached_enum_labels);
+        priv->cached_enum_labels = NULL;
+    }
+}
+
+static void ctl_card_set_property(GObject *obj, guint id, const GValue *val,
+                                  GParamSpec *spec)
+{
+    ALSACtlCard *self = ALSACTL_CARD(obj);
+    ALSACtlCardPrivate *priv = alsactl_card_get_instance_private(self);
+
+    switch (id) {
+    case CTL_CARD_PROP_ELEM_INFO_CACHE:
+        g_mutex_lock(&priv->cache_lock);
+        priv->elem_info_cache = g_value_get_boolean(val);
+        if (!priv->elem_info_cache)
+            drop_all_cached_elem_infos(priv);
+        g_mutex_unlock(&priv->cache_lock);
+        break;
+    case CTL_CARD_PROP_COALESCE_ELEM_EVENTS:
+        priv->coalesce_elem_events = g_value_get_boolean(val);
+        break;
+    default:
+        G_OBJECT_WARN_INVALID_PROPERTY_ID(obj, id, spec);
+        break;
+    }
+}
+
 static void ctl_card_get_property(GObject *obj, guint id, GValue *val,
                                   GParamSpec *spec)
 {
@@ -90,6 +232,18 @@ static void ctl_card_get_property(GObject *obj, guint id, GValue *val,
         g_value_set_boolean(val, subscribed);
         break;
     }
+    case CTL_CARD_PROP_ELEM_INFO_CACHE:
+        g_value_set_boolean(val, priv->elem_info_cache);
+        break;
+    case CTL_CARD_PROP_COALESCE_ELEM_EVENTS:
+        g_value_set_boolean(val, priv->coalesce_elem_events);
+        break;
+    case CTL_CARD_PROP_RECEIVED_ELEM_EVENT_COUNT:
+        g_value_set_uint64(val, priv->received_elem_event_count);
+        break;
+    case CTL_CARD_PROP_COALESCED_ELEM_EVENT_COUNT:
+        g_value_set_uint64(val, priv->coalesced_elem_event_count);
+        break;
     default:
         G_OBJECT_WARN_INVALID_PROPERTY_ID(obj, id, spec);
         break;
@@ -101,11 +255,31 @@ static void ctl_card_finalize(GObject *obj)
     ALSACtlCard *self = ALSACTL_CARD(obj);
     ALSACtlCardPrivate *priv = alsactl_card_get_instance_private(self);
 
+    if (priv->worker_pool != NULL)
+        g_thread_pool_free(priv->worker_pool, FALSE, TRUE);
+    g_mutex_clear(&priv->worker_pool_lock);
+
     if (priv->fd >= 0) {
         close(priv->fd);
         g_free(priv->devnode);
     }
 
+    drop_all_cached_elem_infos(priv);
+    g_mutex_clear(&priv->cache_lock);
+
+    g_free(priv->value_mirror);
+    g_mutex_clear(&priv->mirror_write_lock);
+
+    g_queue_foreach(&priv->pending_writes, (GFunc)g_free, NULL);
+    g_queue_clear(&priv->pending_writes);
+    g_hash_table_destroy(priv->pending_write_table);
+    g_mutex_clear(&priv->write_lock);
+    g_rec_mutex_clear(&priv->flush_lock);
+
+    if (priv->name_index != NULL)
+        g_hash_table_destroy(priv->name_index);
+    g_mutex_clear(&priv->name_index_lock);
+
     G_OBJECT_CLASS(alsactl_card_parent_class)->finalize(obj);
 }
 
@@ -114,6 +288,7 @@ static void alsactl_card_class_init(ALSACtlCardClass *klass)
     GObjectClass *gobject_class = G_OBJECT_CLASS(klass);
 
     gobject_class->finalize = ctl_card_finalize;
+    gobject_class->set_property = ctl_card_set_property;
     gobject_class->get_property = ctl_card_get_property;
 
     /**
@@ -138,6 +313,69 @@ static void alsactl_card_class_init(ALSACtlCardClass *klass)
                              FALSE,
                              G_PARAM_READABLE);
 
+    /**
+     * ALSACtlCard:elem-info-cache:
+     *
+     * Whether to cache information of element retrieved by [method@Card.get_elem_info]. The
+     * cache is keyed by the numeric ID of element and is consulted just while the instance is
+     * subscribed for event by [method@Card.create_source], since the entry is invalidated when
+     * the source dispatches the event with [flags@ElemEventMask] for `INFO`, `TLV`, or `REMOVE`.
+     * The labels of enumerated element are shared between elements with the identical set of
+     * labels. The whole cache is discarded when the property is changed to %FALSE or the last
+     * source is released.
+     *
+     * Since: 0.4.
+     */
+    ctl_card_props[CTL_CARD_PROP_ELEM_INFO_CACHE] =
+        g_param_spec_boolean("elem-info-cache", "elem-info-cache",
+                             "Whether to cache information of element",
+                             FALSE,
+                             G_PARAM_READWRITE);
+
+    /**
+     * ALSACtlCard:coalesce-elem-events:
+     *
+     * Whether to coalesce events for the same element within the batch of events read at once.
+     * When enabled, the masks of events for the same element are merged and
+     * [signal@Card::handle-elem-event] is emitted at most once for the element in each dispatch,
+     * at the position of the first event. The event with `REMOVE` is not merged to the later
+     * events.
+     *
+     * Since: 0.4.
+     */
+    ctl_card_props[CTL_CARD_PROP_COALESCE_ELEM_EVENTS] =
+        g_param_spec_boolean("coalesce-elem-events", "coalesce-elem-events",
+                             "Whether to coalesce events for the same element",
+                             FALSE,
+                             G_PARAM_READWRITE);
+
+    /**
+     * ALSACtlCard:received-elem-event-count:
+     *
+     * The total number of events for element read from ALSA control character device.
+     *
+     * Since: 0.4.
+     */
+    ctl_card_props[CTL_CARD_PROP_RECEIVED_ELEM_EVENT_COUNT] =
+        g_param_spec_uint64("received-elem-event-count", "received-elem-event-count",
+                            "The total number of events for element read from the device",
+                            0, G_MAXUINT64, 0,
+                            G_PARAM_READABLE);
+
+    /**
+     * ALSACtlCard:coalesced-elem-event-count:
+     *
+     * The total number of events for element merged to the preceding event by
+     * [property@Card:coalesce-elem-events].
+     *
+     * Since: 0.4.
+     */
+    ctl_card_props[CTL_CARD_PROP_COALESCED_ELEM_EVENT_COUNT] =
+        g_param_spec_uint64("coalesced-elem-event-count", "coalesced-elem-event-count",
+                            "The total number of events for element merged to the preceding one",
+                            0, G_MAXUINT64, 0,
+                            G_PARAM_READABLE);
+
     g_object_class_install_properties(gobject_class, CTL_CARD_PROP_COUNT,
                                       ctl_card_props);
 
@@ -175,6 +413,26 @@ static void alsactl_card_class_init(ALSACtlCardClass *klass)
                      NULL, NULL,
                      g_cclosure_marshal_VOID__VOID,
                      G_TYPE_NONE, 0, G_TYPE_NONE, 0);
+
+    /**
+     * ALSACtlCard::handle-elem-write:
+     * @self: A [class@Card].
+     * @elem_id: (transfer none): A [struct@ElemId].
+     * @error: (transfer none)(nullable): A [struct@GLib.Error] when the write operation failed.
+     *
+     * Emitted when the value queued by [method@Card.queue_elem_value] is written to the element.
+     *
+     * Since: 0.4.
+     */
+    ctl_card_sigs[CTL_CARD_SIG_HANDLE_ELEM_WRITE] =
+        g_signal_new("handle-elem-write",
+                     G_OBJECT_CLASS_TYPE(klass),
+                     G_SIGNAL_RUN_LAST,
+                     G_STRUCT_OFFSET(ALSACtlCardClass, handle_elem_write),
+                     NULL, NULL,
+                     alsactl_sigs_marshal_VOID__BOXED_BOXED,
+                     G_TYPE_NONE, 2, ALSACTL_TYPE_ELEM_ID | G_SIGNAL_TYPE_STATIC_SCOPE,
+                     G_TYPE_ERROR | G_SIGNAL_TYPE_STATIC_SCOPE);
 }
 
 static void alsactl_card_init(ALSACtlCard *self)
@@ -182,6 +440,17 @@ static void alsactl_card_init(ALSACtlCard *self)
     ALSACtlCardPrivate *priv = alsactl_card_get_instance_private(self);
 
     priv->fd = -1;
+    g_mutex_init(&priv->cache_lock);
+    g_mutex_init(&priv->mirror_write_lock);
+
+    g_mutex_init(&priv->write_lock);
+    g_rec_mutex_init(&priv->flush_lock);
+    g_queue_init(&priv->pending_writes);
+    priv->pending_write_table = g_hash_table_new(g_direct_hash, g_direct_equal);
+
+    g_mutex_init(&priv->name_index_lock);
+
+    g_mutex_init(&priv->worker_pool_lock);
 }
 
 /**
@@ -404,6 +673,7 @@ gboolean alsactl_card_get_elem_id_list(ALSACtlCard *self, GList **entries, GErro
 {
     ALSACtlCardPrivate *priv;
     struct snd_ctl_elem_list list = {0};
+    GList *head = NULL;
     int i;
 
     g_return_val_if_fail(ALSACTL_IS_CARD(self), FALSE);
@@ -415,17 +685,60 @@ gboolean alsactl_card_get_elem_id_list(ALSACtlCard *self, GList **entries, GErro
     if (!allocate_elem_ids(priv->fd, &list, error))
         return FALSE;
 
-    for (i = 0; i < list.count; ++i) {
+    // NOTE: Prepend entries from the last one to avoid traversing the list for each entry. The list
+    // is in the order of identifiers without reversing it.
+    for (i = list.count - 1; i >= 0; --i) {
         struct snd_ctl_elem_id *id = list.pids + i;
         ALSACtlElemId *elem_id = g_boxed_copy(ALSACTL_TYPE_ELEM_ID, id);
-        *entries = g_list_append(*entries, (gpointer)elem_id);
+        head = g_list_prepend(head, (gpointer)elem_id);
     }
+    *entries = g_list_concat(*entries, head);
 
     deallocate_elem_ids(&list);
 
     return TRUE;
 }
 
+/**
+ * alsactl_card_get_elem_id_array:
+ * @self: A [class@Card].
+ * @entries: (array length=entry_count)(out): The array of entries for [struct@ElemId].
+ * @entry_count: The number of entries.
+ * @error: A [struct@GLib.Error]. Error is generated with domain of `ALSACtl.CardError`.
+ *
+ * Generate an array of [struct@ElemId] for ALSA control character device associated to the sound
+ * card. Unlike [method@Card.get_elem_id_list], the entries are stored in a single contiguous
+ * buffer filled by the system call.
+ *
+ * The call of function executes several `ioctl(2)` system call with `SNDRV_CTL_IOCTL_ELEM_LIST`
+ * command for ALSA control character device.
+ *
+ * Returns: %TRUE when the overall operation finishes successfully, else %FALSE.
+ *
+ * Since: 0.4.
+ */
+gboolean alsactl_card_get_elem_id_array(ALSACtlCard *self, ALSACtlElemId **entries,
+                                        gsize *entry_count, GError **error)
+{
+    ALSACtlCardPrivate *priv;
+    struct snd_ctl_elem_list list = {0};
+
+    g_return_val_if_fail(ALSACTL_IS_CARD(self), FALSE);
+    priv = alsactl_card_get_instance_private(self);
+
+    g_return_val_if_fail(entries != NULL, FALSE);
+    g_return_val_if_fail(entry_count != NULL, FALSE);
+    g_return_val_if_fail(error == NULL || *error == NULL, FALSE);
+
+    if (!allocate_elem_ids(priv->fd, &list, error))
+        return FALSE;
+
+    *entries = list.pids;
+    *entry_count = list.count;
+
+    return TRUE;
+}
+
 /**
  * alsactl_card_lock_elem:
  * @self: A [class@Card].
@@ -478,17 +791,20 @@ gboolean alsactl_card_lock_elem(ALSACtlCard *self, const ALSACtlElemId *elem_id,
     return TRUE;
 }
 
-static gboolean parse_enum_names(ALSACtlCardPrivate *priv, struct snd_ctl_elem_info *data,
+static gboolean parse_enum_names(ALSACtlCardPrivate *priv, const struct snd_ctl_elem_info *data,
                                  gchar ***labels, GError **error)
 {
+    // NOTE: The system call overwrites the item and the name, thus the given information is kept
+    // pristine to be cached and returned.
+    struct snd_ctl_elem_info info = *data;
     gsize count = data->value.enumerated.items;
     int i;
 
     *labels = g_malloc0_n(count + 1, sizeof(**labels));
 
     for (i = 0; i < count; ++i) {
-        data->value.enumerated.item = i;
-        if (ioctl(priv->fd, SNDRV_CTL_IOCTL_ELEM_INFO, data)) {
+        info.value.enumerated.item = i;
+        if (ioctl(priv->fd, SNDRV_CTL_IOCTL_ELEM_INFO, &info)) {
             if (errno == ENODEV)
                 generate_local_error(error, ALSACTL_CARD_ERROR_DISCONNECTED);
             else
@@ -496,7 +812,7 @@ static gboolean parse_enum_names(ALSACtlCardPrivate *priv, struct snd_ctl_elem_i
             goto error;
         }
 
-        (*labels)[i] = g_strdup(data->value.enumerated.name);
+        (*labels)[i] = g_strdup(info.value.enumerated.name);
     }
 
     (*labels)[count] = NULL;
@@ -506,6 +822,106 @@ error:
     return FALSE;
 }
 
+static gboolean lookup_cached_elem_info(ALSACtlCardPrivate *priv, struct snd_ctl_elem_info *data,
+                                        struct ctl_elem_enum_labels **labels, guint *generation)
+{
+    struct cached_elem_info *entry = NULL;
+
+    g_mutex_lock(&priv->cache_lock);
+
+    // NOTE: The generation is taken before the system call to retrieve the information. Any
+    // invalidation after it prevents the information from being inserted.
+    *generation = priv->cache_generation;
+
+    // NOTE: The cache is keyed by numeric ID. The element identified by name is always retrieved
+    // by the system call.
+    if (data->id.numid == 0) {
+        g_mutex_unlock(&priv->cache_lock);
+        return FALSE;
+    }
+
+    if (priv->cached_elem_infos != NULL)
+        entry = g_hash_table_lookup(priv->cached_elem_infos, GUINT_TO_POINTER(data->id.numid));
+
+    if (entry != NULL) {
+        *data = entry->data;
+        if (entry->labels != NULL)
+            *labels = ctl_elem_enum_labels_ref(entry->labels->labels);
+    }
+
+    g_mutex_unlock(&priv->cache_lock);
+
+    return entry != NULL;
+}
+
+static void insert_cached_elem_info(ALSACtlCardPrivate *priv, const struct snd_ctl_elem_info *data,
+                                    struct ctl_elem_enum_labels **labels, guint generation)
+{
+    struct cached_elem_info *entry;
+
+    g_mutex_lock(&priv->cache_lock);
+
+    // NOTE: The entry can not be invalidated without subscription of event.
+    if (!priv->elem_info_cache || g_atomic_int_get(&priv->subscribers) == 0)
+        goto end;
+
+    // NOTE: Any entry is invalidated while the information is retrieved, thus the information can
+    // be stale.
+    if (priv->cache_generation != generation)
+        goto end;
+
+    if (priv->cached_elem_infos == NULL) {
+        priv->cached_elem_infos = g_hash_table_new_full(g_direct_hash, g_direct_equal,
+                                                        NULL, g_free);
+        priv->cached_enum_labels = g_hash_table_new_full(enum_labels_hash, enum_labels_equal,
+                                                         NULL, free_cached_enum_labels);
+    }
+
+    drop_cached_elem_info(priv, data->id.numid);
+
+    entry = g_malloc0(sizeof(*entry));
+    entry->data = *data;
+
+    if (*labels != NULL) {
+        struct cached_enum_labels *cached;
+
+        cached = g_hash_table_lookup(priv->cached_enum_labels, (*labels)->labels);
+        if (cached == NULL) {
+            cached = g_malloc0(sizeof(*cached));
+            cached->labels = ctl_elem_enum_labels_ref(*labels);
+            g_hash_table_insert(priv->cached_enum_labels, cached->labels->labels, cached);
+        } else {
+            ctl_elem_enum_labels_unref(*labels);
+            *labels = ctl_elem_enum_labels_ref(cached->labels);
+        }
+
+        ++cached->entry_count;
+        entry->labels = cached;
+    }
+
+    g_hash_table_insert(priv->cached_elem_infos, GUINT_TO_POINTER(data->id.numid), entry);
+end:
+    g_mutex_unlock(&priv->cache_lock);
+}
+
+// Return the number of values in the element when the information is cached, else zero.
+static guint lookup_cached_value_count(ALSACtlCardPrivate *priv, guint numid)
+{
+    struct cached_elem_info *entry = NULL;
+    guint value_count = 0;
+
+    g_mutex_lock(&priv->cache_lock);
+
+    if (priv->cached_elem_infos != NULL)
+        entry = g_hash_table_lookup(priv->cached_elem_infos, GUINT_TO_POINTER(numid));
+    if (entry != NULL)
+        value_count = entry->data.count;
+
+    g_mutex_unlock(&priv->cache_lock);
+
+    return value_count;
+}
+
 /**
  * alsactl_card_get_elem_info:
  * @self: A [class@Card].
@@ -517,7 +933,8 @@ error:
  *
  * The call of function executes `ioctl(2)` system call with `SNDRV_CTL_IOCTL_ELEM_INFO` command
  * for ALSA control character device. For enumerated element, it executes the system call for
- * several times to retrieve all of enumeration labels.
+ * several times to retrieve all of enumeration labels. When [property@Card:elem-info-cache] is
+ * enabled and the information is already cached, no system call is executed.
  *
  * Returns: %TRUE when the overall operation finishes successfully, else %FALSE.
  */
@@ -526,6 +943,8 @@ gboolean alsactl_card_get_elem_info(ALSACtlCard *self, const ALSACtlElemId *elem
 {
     ALSACtlCardPrivate *priv;
     struct snd_ctl_elem_info *dst, data = {0};
+    struct ctl_elem_enum_labels *labels = NULL;
+    guint generation;
 
     g_return_val_if_fail(ALSACTL_IS_CARD(self), FALSE);
     priv = alsactl_card_get_instance_private(self);
@@ -535,14 +954,26 @@ gboolean alsactl_card_get_elem_info(ALSACtlCard *self, const ALSACtlElemId *elem
     g_return_val_if_fail(error == NULL || *error == NULL, FALSE);
 
     data.id = *elem_id;
-    if (ioctl(priv->fd, SNDRV_CTL_IOCTL_ELEM_INFO, &data)) {
-        if (errno == ENODEV)
-            generate_local_error(error, ALSACTL_CARD_ERROR_DISCONNECTED);
-        else if (errno == ENOENT)
-            generate_local_error(error, ALSACTL_CARD_ERROR_ELEM_NOT_FOUND);
-        else
-            generate_syscall_error(error, errno, "ioctl(%s)", "ELEM_INFO");
-        return FALSE;
+    if (!lookup_cached_elem_info(priv, &data, &labels, &generation)) {
+        if (ioctl(priv->fd, SNDRV_CTL_IOCTL_ELEM_INFO, &data)) {
+            if (errno == ENODEV)
+                generate_local_error(error, ALSACTL_CARD_ERROR_DISCONNECTED);
+            else if (errno == ENOENT)
+                generate_local_error(error, ALSACTL_CARD_ERROR_ELEM_NOT_FOUND);
+            else
+                generate_syscall_error(error, errno, "ioctl(%s)", "ELEM_INFO");
+            return FALSE;
+        }
+
+        if (data.type == SNDRV_CTL_ELEM_TYPE_ENUMERATED) {
+            gchar **entries;
+
+            if (!parse_enum_names(priv, &data, &entries, error))
+                return FALSE;
+            labels = ctl_elem_enum_labels_new(entries);
+        }
+
+        insert_cached_elem_info(priv, &data, &labels, generation);
     }
 
     switch (data.type) {
@@ -583,15 +1014,9 @@ gboolean alsactl_card_get_elem_info(ALSACtlCard *self, const ALSACtlElemId *elem
     }
     case SNDRV_CTL_ELEM_TYPE_ENUMERATED:
     {
-        ALSACtlElemInfoEnumerated *info;
-        gchar **labels;
-
-        if (!parse_enum_names(priv, &data, &labels, error))
-            return FALSE;
-
-        info = alsactl_elem_info_enumerated_new();
-        g_object_set(info, "labels", labels, NULL);
-        g_strfreev(labels);
+        ALSACtlElemInfoEnumerated *info = alsactl_elem_info_enumerated_new();
+        ctl_elem_info_enumerated_share_labels(info, labels);
+        ctl_elem_enum_labels_unref(labels);
         ctl_elem_info_enumerated_refer_private(info, &dst);
         *elem_info = ALSACTL_ELEM_INFO_COMMON(info);
 
@@ -823,6 +1248,7 @@ static gboolean add_or_replace_elems(int fd, const ALSACtlElemId *elem_id, guint
     const char *req_name;
     gboolean result;
     struct snd_ctl_elem_id src;
+    GList *head;
     int i;
 
     g_object_get(elem_info, "elem-type", &elem_type, NULL);
@@ -921,14 +1347,19 @@ static gboolean add_or_replace_elems(int fd, const ALSACtlElemId *elem_id, guint
     if (!result)
         return FALSE;
 
-    src = data->id;
-    for (i = 0; i < elem_count; ++i) {
-        ALSACtlElemId *entry = g_boxed_copy(ALSACTL_TYPE_ELEM_ID, &src);
-        *entries = g_list_append(*entries, (gpointer)entry);
-
-        ++src.numid;
-        ++src.index;
+    // NOTE: The identifiers are sequential. Prepend entries from the last one to avoid traversing
+    // the list for each entry.
+    head = NULL;
+    for (i = elem_count - 1; i >= 0; --i) {
+        ALSACtlElemId *entry;
+
+        src = data->id;
+        src.numid += i;
+        src.index += i;
+        entry = g_boxed_copy(ALSACTL_TYPE_ELEM_ID, &src);
+        head = g_list_prepend(head, (gpointer)entry);
     }
+    *entries = g_list_concat(*entries, head);
 
     return TRUE;
 }
@@ -1100,6 +1531,7 @@ gboolean alsactl_card_read_elem_value(ALSACtlCard *self, const ALSACtlElemId *el
 {
     ALSACtlCardPrivate *priv;
     struct snd_ctl_elem_value *value;
+    guint value_count;
 
     g_return_val_if_fail(ALSACTL_IS_CARD(self), FALSE);
     priv = alsactl_card_get_instance_private(self);
@@ -1122,48 +1554,1235 @@ gboolean alsactl_card_read_elem_value(ALSACtlCard *self, const ALSACtlElemId *el
             generate_syscall_error(error, errno, "ioctl(%s)", "ELEM_READ");
         return FALSE;
     }
+
+    // NOTE: The conversion of values is bounded by the number of values in the element when the
+    // information is cached.
+    value_count = lookup_cached_value_count(priv, value->id.numid);
+    if (value_count > 0)
+        ctl_elem_value_set_value_count(*elem_value, value_count);
+
     return TRUE;
 }
 
-static void handle_elem_event(CtlCardSource *src, struct snd_ctl_event *ev)
+/**
+ * alsactl_card_write_elem_compact_value:
+ * @self: A [class@Card].
+ * @elem_id: A [struct@ElemId].
+ * @elem_value: A [struct@CompactElemValue].
+ * @error: A [struct@GLib.Error]. Error is generated with domain of `ALSACtl.CardError`.
+ *
+ * Write given value to element indicated by the given identifier.
+ *
+ * The call of function executes `ioctl(2)` system call with `SNDRV_CTL_IOCTL_ELEM_WRITE` command
+ * for ALSA control character device.
+ *
+ * Returns: %TRUE when the overall operation finishes successfully, else %FALSE.
+ *
+ * Since: 0.4.
+ */
+gboolean alsactl_card_write_elem_compact_value(ALSACtlCard *self, const ALSACtlElemId *elem_id,
+                                               const ALSACtlCompactElemValue *elem_value,
+                                               GError **error)
 {
-    ALSACtlCard *self = src->self;
-    ALSACtlElemId *elem_id;
-    ALSACtlElemEventMask mask;
+    ALSACtlCardPrivate *priv;
+    struct snd_ctl_elem_value value = {0};
+    void *storage;
+    gsize size;
 
-    elem_id = &ev->data.elem.id;
+    g_return_val_if_fail(ALSACTL_IS_CARD(self), FALSE);
+    priv = alsactl_card_get_instance_private(self);
 
-    if (ev->data.elem.mask != SNDRV_CTL_EVENT_MASK_REMOVE)
-        mask = ev->data.elem.mask;
-    else
-        mask = ALSACTL_ELEM_EVENT_MASK_REMOVE;
+    g_return_val_if_fail(elem_id != NULL, FALSE);
+    g_return_val_if_fail(elem_value != NULL, FALSE);
+    g_return_val_if_fail(error == NULL || *error == NULL, FALSE);
 
-    g_signal_emit(self, ctl_card_sigs[CTL_CARD_SIG_HANDLE_ELEM_EVENT], 0,
-                  elem_id, mask);
-}
+    ctl_compact_elem_value_refer_private((ALSACtlCompactElemValue *)elem_value, &storage, &size);
+    value.id = *elem_id;
+    memcpy(&value.value, storage, MIN(size, sizeof(value.value)));
 
-static gboolean ctl_card_check_src(GSource *gsrc)
-{
-    CtlCardSource *src = (CtlCardSource *)gsrc;
-    GIOCondition condition;
+    if (ioctl(priv->fd, SNDRV_CTL_IOCTL_ELEM_WRITE, &value) < 0) {
+        if (errno == ENODEV)
+            generate_local_error(error, ALSACTL_CARD_ERROR_DISCONNECTED);
+        else if (errno == ENOENT)
+            generate_local_error(error, ALSACTL_CARD_ERROR_ELEM_NOT_FOUND);
+        else if (errno == EPERM)
+            generate_local_error(error, ALSACTL_CARD_ERROR_ELEM_NOT_SUPPORTED);
+        else
+            generate_syscall_error(error, errno, "ioctl(%s)", "ELEM_WRITE");
+        return FALSE;
+    }
 
-    // Don't go to dispatch if nothing available. As an exception, return TRUE
-    // for POLLERR to call .dispatch for internal destruction.
-    condition = g_source_query_unix_fd(gsrc, src->tag);
-    return !!(condition & (G_IO_IN | G_IO_ERR));
+    return TRUE;
 }
 
-static gboolean ctl_card_dispatch_src(GSource *gsrc, GSourceFunc cb,
-                                      gpointer user_data)
-{
-    CtlCardSource *src = (CtlCardSource *)gsrc;
-    ALSACtlCard *self = src->self;
-    ALSACtlCardPrivate *priv;
-    GIOCondition condition;
-    int len;
-    struct snd_ctl_event *ev;
-
-    priv = alsactl_card_get_instance_private(self);
+/**
+ * alsactl_card_read_elem_compact_value:
+ * @self: A [class@Card].
+ * @elem_id: A [struct@ElemId].
+ * @elem_value: (inout): A [struct@CompactElemValue].
+ * @error: A [struct@GLib.Error]. Error is generated with domain of `ALSACtl.CardError`.
+ *
+ * Read given value from element indicated by the given identifier.
+ *
+ * The call of function executes `ioctl(2)` system call with `SNDRV_CTL_IOCTL_ELEM_READ` command
+ * for ALSA control character device.
+ *
+ * Returns: %TRUE when the overall operation finishes successfully, else %FALSE.
+ *
+ * Since: 0.4.
+ */
+gboolean alsactl_card_read_elem_compact_value(ALSACtlCard *self, const ALSACtlElemId *elem_id,
+                                              ALSACtlCompactElemValue *const *elem_value,
+                                              GError **error)
+{
+    ALSACtlCardPrivate *priv;
+    struct snd_ctl_elem_value value = {0};
+    void *storage;
+    gsize size;
+
+    g_return_val_if_fail(ALSACTL_IS_CARD(self), FALSE);
+    priv = alsactl_card_get_instance_private(self);
+
+    g_return_val_if_fail(elem_id != NULL, FALSE);
+    g_return_val_if_fail(elem_value != NULL && *elem_value != NULL, FALSE);
+    g_return_val_if_fail(error == NULL || *error == NULL, FALSE);
+
+    value.id = *elem_id;
+
+    if (ioctl(priv->fd, SNDRV_CTL_IOCTL_ELEM_READ, &value) < 0) {
+        if (errno == ENODEV)
+            generate_local_error(error, ALSACTL_CARD_ERROR_DISCONNECTED);
+        else if (errno == ENOENT)
+            generate_local_error(error, ALSACTL_CARD_ERROR_ELEM_NOT_FOUND);
+        else if (errno == EPERM)
+            generate_local_error(error, ALSACTL_CARD_ERROR_ELEM_NOT_SUPPORTED);
+        else
+            generate_syscall_error(error, errno, "ioctl(%s)", "ELEM_READ");
+        return FALSE;
+    }
+
+    ctl_compact_elem_value_refer_private(*elem_value, &storage, &size);
+    memcpy(storage, &value.value, MIN(size, sizeof(value.value)));
+
+    return TRUE;
+}
+
+#define ELEM_VALUE_STORAGE_SIZE     sizeof(((struct snd_ctl_elem_value *)0)->value)
+
+// NOTE: The calling thread waits till the workers in the pool finish the rest of ranges.
+struct elem_values_batch {
+    GMutex mutex;
+    GCond cond;
+    gsize pending;
+    gint disconnected;
+};
+
+struct elem_values_task {
+    int fd;
+    unsigned long request;
+    const ALSACtlElemId *elem_ids;
+    guint8 *values;
+    gsize value_size;
+    gint *statuses;
+    gsize begin;
+    gsize end;
+    gint *disconnected;
+    struct elem_values_batch *batch;
+};
+
+static void process_elem_values(struct elem_values_task *task)
+{
+    struct snd_ctl_elem_value scratch = {0};
+    gsize i;
+
+    // NOTE: The same storage is reused for all of elements in the range.
+    for (i = task->begin; i < task->end; ++i) {
+        guint8 *value = task->values + task->value_size * i;
+
+        if (g_atomic_int_get(task->disconnected)) {
+            task->statuses[i] = ENODEV;
+            continue;
+        }
+
+        scratch.id = task->elem_ids[i];
+        if (task->request == SNDRV_CTL_IOCTL_ELEM_WRITE) {
+            memset(&scratch.value, 0, sizeof(scratch.value));
+            memcpy(&scratch.value, value, task->value_size);
+        }
+
+        if (ioctl(task->fd, task->request, &scratch) < 0) {
+            task->statuses[i] = errno;
+            if (errno == ENODEV)
+                g_atomic_int_set(task->disconnected, TRUE);
+            continue;
+        }
+
+        if (task->request == SNDRV_CTL_IOCTL_ELEM_READ)
+            memcpy(value, &scratch.value, task->value_size);
+
+        task->statuses[i] = 0;
+    }
+}
+
+static void complete_elem_values_task(struct elem_values_task *task)
+{
+    struct elem_values_batch *batch = task->batch;
+
+    g_mutex_lock(&batch->mutex);
+    if (--batch->pending == 0)
+        g_cond_signal(&batch->cond);
+    g_mutex_unlock(&batch->mutex);
+}
+
+static void run_elem_values_worker(gpointer data, gpointer user_data)
+{
+    struct elem_values_task *task = data;
+
+    process_elem_values(task);
+    complete_elem_values_task(task);
+}
+
+// NOTE: The pool is kept by the instance so that threads are not created for each call. The pool
+// has exclusive threads so that no thread is created when pushing the task.
+static GThreadPool *get_elem_values_pool(ALSACtlCardPrivate *priv)
+{
+    GThreadPool *pool;
+
+    g_mutex_lock(&priv->worker_pool_lock);
+
+    if (priv->worker_pool == NULL) {
+        // The calling thread processes one of ranges by itself.
+        guint thread_count = g_get_num_processors() - 1;
+
+        if (thread_count > 0) {
+            priv->worker_pool = g_thread_pool_new(run_elem_values_worker, NULL, thread_count,
+                                                  TRUE, NULL);
+        }
+    }
+    pool = priv->worker_pool;
+
+    g_mutex_unlock(&priv->worker_pool_lock);
+
+    return pool;
+}
+
+static gboolean process_elem_value_batch(ALSACtlCardPrivate *priv, unsigned long request,
+                                         const char *req_name, const ALSACtlElemId *elem_ids,
+                                         gsize elem_count, guint8 *values, gsize values_length,
+                                         guint worker_count, gint *statuses, GError **error)
+{
+    struct elem_values_batch batch = {0};
+    struct elem_values_task *tasks;
+    gint *entries = statuses;
+    gsize value_size = values_length / elem_count;
+    GThreadPool *pool = NULL;
+    gsize chunk;
+    gboolean result = TRUE;
+    gsize i;
+
+    if (entries == NULL)
+        entries = g_malloc0_n(elem_count, sizeof(*entries));
+
+    // NOTE: The number of threads more than the number of processors brings no benefit.
+    if (worker_count == 0)
+        worker_count = 1;
+    if (worker_count > g_get_num_processors())
+        worker_count = g_get_num_processors();
+    if (worker_count > elem_count)
+        worker_count = elem_count;
+    chunk = (elem_count + worker_count - 1) / worker_count;
+
+    g_mutex_init(&batch.mutex);
+    g_cond_init(&batch.cond);
+
+    tasks = g_malloc0_n(worker_count, sizeof(*tasks));
+    for (i = 0; i < worker_count; ++i) {
+        struct elem_values_task *task = tasks + i;
+
+        task->fd = priv->fd;
+        task->request = request;
+        task->elem_ids = elem_ids;
+        task->values = values;
+        task->value_size = value_size;
+        task->statuses = entries;
+        task->begin = chunk * i;
+        task->end = MIN(chunk * (i + 1), elem_count);
+        task->disconnected = &batch.disconnected;
+        task->batch = &batch;
+    }
+
+    if (worker_count > 1)
+        pool = get_elem_values_pool(priv);
+
+    if (pool == NULL) {
+        // The calling thread processes all of ranges when the pool is not available.
+        for (i = 0; i < worker_count; ++i)
+            process_elem_values(tasks + i);
+    } else {
+        batch.pending = worker_count - 1;
+
+        // NOTE: The calling thread processes the first range by itself, as well as the range
+        // which fails to be passed to the pool.
+        for (i = 1; i < worker_count; ++i) {
+            if (!g_thread_pool_push(pool, tasks + i, NULL)) {
+                process_elem_values(tasks + i);
+                complete_elem_values_task(tasks + i);
+            }
+        }
+
+        process_elem_values(tasks);
+
+        g_mutex_lock(&batch.mutex);
+        while (batch.pending > 0)
+            g_cond_wait(&batch.cond, &batch.mutex);
+        g_mutex_unlock(&batch.mutex);
+    }
+
+    g_free(tasks);
+    g_mutex_clear(&batch.mutex);
+    g_cond_clear(&batch.cond);
+
+    // The first failure in the order of identifiers is reported.
+    for (i = 0; i < elem_count; ++i) {
+        gint status = entries[i];
+
+        if (status == 0)
+            continue;
+
+        if (status == ENODEV)
+            generate_local_error(error, ALSACTL_CARD_ERROR_DISCONNECTED);
+        else if (status == ENOENT)
+            generate_local_error(error, ALSACTL_CARD_ERROR_ELEM_NOT_FOUND);
+        else if (status == EPERM)
+            generate_local_error(error, ALSACTL_CARD_ERROR_ELEM_NOT_SUPPORTED);
+        else
+            generate_syscall_error(error, status, "ioctl(%s)", req_name);
+        result = FALSE;
+        break;
+    }
+
+    if (statuses == NULL)
+        g_free(entries);
+
+    return result;
+}
+
+/**
+ * alsactl_card_write_elem_values:
+ * @self: A [class@Card].
+ * @elem_ids: (array length=elem_count): The array of [struct@ElemId].
+ * @elem_count: The number of elements in the array.
+ * @values: (array length=values_length): The buffer including the value of each element.
+ * @values_length: The size of buffer in byte unit. It should be multiple of @elem_count, else the
+ *                 call results in failure of precondition.
+ * @worker_count: The number of threads to execute the system calls. 0 or 1 means that the calling
+ *                thread executes all of them. It is limited by the number of processors.
+ * @statuses: (array length=elem_count)(out caller-allocates)(optional): The array to store the
+ *            result for each element; 0 or the value of `errno`.
+ * @error: A [struct@GLib.Error]. Error is generated with domain of `ALSACtl.CardError`.
+ *
+ * Write the given values to elements indicated by the given identifiers.
+ *
+ * The buffer is split equally for each element in the order of identifiers. Each part of buffer is
+ * copied to the head of `value` member in `struct snd_ctl_elem_value` and the rest is filled by
+ * zero, thus it should have the same layout as the member; e.g. `long` for boolean and integer
+ * type, `long long` for integer64 type, `unsigned int` for enumerated type.
+ *
+ * The call of function executes `ioctl(2)` system call with `SNDRV_CTL_IOCTL_ELEM_WRITE` command
+ * for ALSA control character device for each element. The failure for an element does not stop
+ * the operation for the rest of elements except for disconnection, and the first failure in the
+ * order of identifiers is reported by the error argument. When the driver handles the system call
+ * slowly, the work can be spread to several threads. The threads are kept by the instance for the
+ * later calls. When they are not available, the calling thread executes all of the system calls.
+ *
+ * Returns: %TRUE when the overall operation finishes successfully, else %FALSE.
+ *
+ * Since: 0.4.
+ */
+gboolean alsactl_card_write_elem_values(ALSACtlCard *self, const ALSACtlElemId *elem_ids,
+                                        gsize elem_count, const guint8 *values,
+                                        gsize values_length, guint worker_count, gint *statuses,
+                                        GError **error)
+{
+    ALSACtlCardPrivate *priv;
+
+    g_return_val_if_fail(ALSACTL_IS_CARD(self), FALSE);
+    priv = alsactl_card_get_instance_private(self);
+
+    g_return_val_if_fail(elem_ids != NULL, FALSE);
+    g_return_val_if_fail(elem_count > 0, FALSE);
+    g_return_val_if_fail(values != NULL, FALSE);
+    g_return_val_if_fail(values_length % elem_count == 0, FALSE);
+    g_return_val_if_fail(values_length / elem_count <= ELEM_VALUE_STORAGE_SIZE, FALSE);
+    g_return_val_if_fail(error == NULL || *error == NULL, FALSE);
+
+    return process_elem_value_batch(priv, SNDRV_CTL_IOCTL_ELEM_WRITE, "ELEM_WRITE", elem_ids,
+                                    elem_count, (guint8 *)values, values_length, worker_count,
+                                    statuses, error);
+}
+
+/**
+ * alsactl_card_read_elem_values:
+ * @self: A [class@Card].
+ * @elem_ids: (array length=elem_count): The array of [struct@ElemId].
+ * @elem_count: The number of elements in the array.
+ * @values: (array length=values_length)(inout): The buffer to be filled with the value of each
+ *          element.
+ * @values_length: The size of buffer in byte unit. It should be multiple of @elem_count, else the
+ *                 call results in failure of precondition.
+ * @worker_count: The number of threads to execute the system calls. 0 or 1 means that the calling
+ *                thread executes all of them. It is limited by the number of processors.
+ * @statuses: (array length=elem_count)(out caller-allocates)(optional): The array to store the
+ *            result for each element; 0 or the value of `errno`.
+ * @error: A [struct@GLib.Error]. Error is generated with domain of `ALSACtl.CardError`.
+ *
+ * Read values from elements indicated by the given identifiers.
+ *
+ * The buffer is split equally for each element in the order of identifiers. Each part of buffer is
+ * filled with the head of `value` member in `struct snd_ctl_elem_value`, thus it has the same
+ * layout as the member; e.g. `long` for boolean and integer type, `long long` for integer64 type,
+ * `unsigned int` for enumerated type.
+ *
+ * The call of function executes `ioctl(2)` system call with `SNDRV_CTL_IOCTL_ELEM_READ` command
+ * for ALSA control character device for each element. The failure for an element does not stop
+ * the operation for the rest of elements except for disconnection, and the first failure in the
+ * order of identifiers is reported by the error argument. When the driver handles the system call
+ * slowly, the work can be spread to several threads. The threads are kept by the instance for the
+ * later calls. When they are not available, the calling thread executes all of the system calls.
+ *
+ * Returns: %TRUE when the overall operation finishes successfully, else %FALSE.
+ *
+ * Since: 0.4.
+ */
+gboolean alsactl_card_read_elem_values(ALSACtlCard *self, const ALSACtlElemId *elem_ids,
+                                       gsize elem_count, guint8 *const *values,
+                                       gsize values_length, guint worker_count, gint *statuses,
+                                       GError **error)
+{
+    ALSACtlCardPrivate *priv;
+
+    g_return_val_if_fail(ALSACTL_IS_CARD(self), FALSE);
+    priv = alsactl_card_get_instance_private(self);
+
+    g_return_val_if_fail(elem_ids != NULL, FALSE);
+    g_return_val_if_fail(elem_count > 0, FALSE);
+    g_return_val_if_fail(values != NULL && *values != NULL, FALSE);
+    g_return_val_if_fail(values_length % elem_count == 0, FALSE);
+    g_return_val_if_fail(values_length / elem_count <= ELEM_VALUE_STORAGE_SIZE, FALSE);
+    g_return_val_if_fail(error == NULL || *error == NULL, FALSE);
+
+    return process_elem_value_batch(priv, SNDRV_CTL_IOCTL_ELEM_READ, "ELEM_READ", elem_ids,
+                                    elem_count, *values, values_length, worker_count, statuses,
+                                    error);
+}
+
+// NOTE: The slot is written by the thread to dispatch event, and read by any thread without lock.
+// The sequence number is odd during writing so that reader can detect torn read and retry. The
+// writers are serialized by the mutex for the card, since the sources can dispatch in several
+// threads. The stamp is for the order of system calls to read the value.
+struct elem_value_slot {
+    gint seq;
+    gboolean present;
+    guint8 value[ELEM_VALUE_STORAGE_SIZE];
+    gsize stamp;
+};
+
+struct elem_value_mirror {
+    guint slot_count;
+    struct elem_value_slot slots[];
+};
+
+static struct elem_value_mirror *allocate_elem_value_mirror(guint slot_count)
+{
+    struct elem_value_mirror *mirror;
+
+    mirror = g_malloc0(sizeof(*mirror) + sizeof(*mirror->slots) * slot_count);
+    mirror->slot_count = slot_count;
+
+    return mirror;
+}
+
+// Publish the storage, then release the previous one. The call should be done with
+// mirror_write_lock held.
+static void replace_elem_value_mirror(ALSACtlCardPrivate *priv, struct elem_value_mirror *mirror)
+{
+    struct elem_value_mirror *prev = priv->value_mirror;
+
+    g_atomic_pointer_set(&priv->value_mirror, mirror);
+
+    // NOTE: The readers count themselves before loading the pointer, thus the ones which can refer
+    // to the previous storage are finished when the counter is zero.
+    while (g_atomic_int_get(&priv->mirror_readers) > 0)
+        g_thread_yield();
+
+    g_free(prev);
+}
+
+// Return whether the slot for the element is available. The storage is expanded when required.
+static gboolean prepare_mirrored_slot(ALSACtlCardPrivate *priv, guint numid, gboolean expand)
+{
+    struct elem_value_mirror *mirror;
+    gboolean result = FALSE;
+
+    g_mutex_lock(&priv->mirror_write_lock);
+
+    mirror = priv->value_mirror;
+    if (mirror == NULL)
+        goto end;
+
+    if (numid >= mirror->slot_count) {
+        struct elem_value_mirror *expanded;
+
+        if (!expand)
+            goto end;
+
+        // NOTE: The slots are copied to the new storage, since the readers can still refer to the
+        // previous storage.
+        expanded = allocate_elem_value_mirror(MAX(mirror->slot_count * 2, numid + 1));
+        memcpy(expanded->slots, mirror->slots, sizeof(*mirror->slots) * mirror->slot_count);
+        replace_elem_value_mirror(priv, expanded);
+    }
+
+    result = TRUE;
+end:
+    g_mutex_unlock(&priv->mirror_write_lock);
+
+    return result;
+}
+
+static void publish_mirrored_slot(ALSACtlCardPrivate *priv, guint numid, gsize stamp,
+                                  gboolean present, const void *value)
+{
+    struct elem_value_mirror *mirror;
+    struct elem_value_slot *slot;
+
+    g_mutex_lock(&priv->mirror_write_lock);
+
+    mirror = priv->value_mirror;
+    if (mirror == NULL || numid >= mirror->slot_count)
+        goto end;
+    slot = mirror->slots + numid;
+
+    // The value read by the system call executed later is already published.
+    if ((gssize)(stamp - slot->stamp) <= 0)
+        goto end;
+
+    g_atomic_int_inc(&slot->seq);
+    slot->present = present;
+    if (present)
+        memcpy(slot->value, value, sizeof(slot->value));
+    g_atomic_int_inc(&slot->seq);
+    slot->stamp = stamp;
+end:
+    g_mutex_unlock(&priv->mirror_write_lock);
+}
+
+// NOTE: The stamp is taken before the system call, thus the value read by the call after any
+// event is not overwritten by the value read by the call before the event.
+static gsize take_mirror_stamp(ALSACtlCardPrivate *priv)
+{
+    return (gsize)g_atomic_pointer_add(&priv->mirror_stamp, 1) + 1;
+}
+
+// The system call is executed without lock, then the result is published.
+static gboolean read_mirrored_slot(ALSACtlCardPrivate *priv, guint numid, GError **error)
+{
+    struct snd_ctl_elem_value scratch = {0};
+    gboolean present = TRUE;
+    gsize stamp;
+
+    stamp = take_mirror_stamp(priv);
+
+    scratch.id.numid = numid;
+    if (ioctl(priv->fd, SNDRV_CTL_IOCTL_ELEM_READ, &scratch) < 0) {
+        if (errno == ENODEV) {
+            generate_local_error(error, ALSACTL_CARD_ERROR_DISCONNECTED);
+            return FALSE;
+        }
+        // The element is not readable or already removed.
+        present = FALSE;
+    }
+
+    publish_mirrored_slot(priv, numid, stamp, present, &scratch.value);
+
+    return TRUE;
+}
+
+static void update_elem_value_mirror(ALSACtlCardPrivate *priv, guint numid, unsigned int mask)
+{
+    if (mask == SNDRV_CTL_EVENT_MASK_REMOVE) {
+        publish_mirrored_slot(priv, numid, take_mirror_stamp(priv), FALSE, NULL);
+        return;
+    }
+
+    if (!(mask & (SNDRV_CTL_EVENT_MASK_VALUE | SNDRV_CTL_EVENT_MASK_ADD)))
+        return;
+
+    if (prepare_mirrored_slot(priv, numid, !!(mask & SNDRV_CTL_EVENT_MASK_ADD)))
+        read_mirrored_slot(priv, numid, NULL);
+}
+
+/**
+ * alsactl_card_start_value_mirror:
+ * @self: A [class@Card].
+ * @error: A [struct@GLib.Error]. Error is generated with domain of `ALSACtl.CardError`.
+ *
+ * Start maintaining the mirror of values for all elements in the sound card. The mirror is a
+ * contiguous storage indexed by the numeric ID of element. It is filled once in the call, then the
+ * value of element is read again just when the source created by [method@Card.create_source]
+ * dispatches the event with [flags@ElemEventMask] for `VALUE`, thus the instance should be
+ * subscribed for event in advance. [method@Card.read_mirrored_elem_value] retrieves the last known
+ * value from the mirror without any system call. The mirror is released when the last source is
+ * released. The empty mirror is published before filled, and the value read in the dispatch of
+ * event for `VALUE` is not overwritten by the value read earlier in the call, thus the change of
+ * value during the call is not lost.
+ *
+ * The call of function executes `ioctl(2)` system call with `SNDRV_CTL_IOCTL_ELEM_LIST` and
+ * `SNDRV_CTL_IOCTL_ELEM_READ` command for ALSA control character device.
+ *
+ * Returns: %TRUE when the overall operation finishes successfully, else %FALSE.
+ *
+ * Since: 0.4.
+ */
+gboolean alsactl_card_start_value_mirror(ALSACtlCard *self, GError **error)
+{
+    ALSACtlCardPrivate *priv;
+    struct snd_ctl_elem_list list = {0};
+    struct elem_value_mirror *mirror;
+    guint max_numid = 0;
+    int i;
+
+    g_return_val_if_fail(ALSACTL_IS_CARD(self), FALSE);
+    priv = alsactl_card_get_instance_private(self);
+    g_return_val_if_fail(priv->fd >= 0, FALSE);
+    g_return_val_if_fail(g_atomic_int_get(&priv->subscribers) > 0, FALSE);
+
+    g_return_val_if_fail(error == NULL || *error == NULL, FALSE);
+
+    if (!allocate_elem_ids(priv->fd, &list, error))
+        return FALSE;
+
+    for (i = 0; i < list.count; ++i)
+        max_numid = MAX(max_numid, list.pids[i].numid);
+
+    mirror = allocate_elem_value_mirror(max_numid + 1);
+
+    // NOTE: The empty mirror is published in advance, then filled without lock. The stamp of each
+    // slot keeps the value read in the dispatch of events during the fill.
+    g_mutex_lock(&priv->mirror_write_lock);
+    replace_elem_value_mirror(priv, mirror);
+    g_mutex_unlock(&priv->mirror_write_lock);
+
+    for (i = 0; i < list.count; ++i) {
+        if (!read_mirrored_slot(priv, list.pids[i].numid, error)) {
+            g_mutex_lock(&priv->mirror_write_lock);
+            replace_elem_value_mirror(priv, NULL);
+            g_mutex_unlock(&priv->mirror_write_lock);
+            break;
+        }
+    }
+
+    deallocate_elem_ids(&list);
+
+    return i == list.count;
+}
+
+/**
+ * alsactl_card_stop_value_mirror:
+ * @self: A [class@Card].
+ *
+ * Stop maintaining the mirror of values started by [method@Card.start_value_mirror] and release
+ * the storage.
+ *
+ * Since: 0.4.
+ */
+void alsactl_card_stop_value_mirror(ALSACtlCard *self)
+{
+    ALSACtlCardPrivate *priv;
+
+    g_return_if_fail(ALSACTL_IS_CARD(self));
+    priv = alsactl_card_get_instance_private(self);
+
+    g_mutex_lock(&priv->mirror_write_lock);
+    replace_elem_value_mirror(priv, NULL);
+    g_mutex_unlock(&priv->mirror_write_lock);
+}
+
+/**
+ * alsactl_card_read_mirrored_elem_value:
+ * @self: A [class@Card].
+ * @elem_id: A [struct@ElemId] with the numeric ID of element.
+ * @elem_value: (inout): A derivative of #ALSACtlElemValue.
+ * @error: A [struct@GLib.Error]. Error is generated with domain of `ALSACtl.CardError`.
+ *
+ * Read the last known value of element from the mirror maintained after the call of
+ * [method@Card.start_value_mirror]. The call is available in any thread and executes no system
+ * call. When the mirror is not maintained or the element is not readable, the error is reported
+ * with `ALSACtl.CardError.ELEM_NOT_FOUND`.
+ *
+ * Returns: %TRUE when the overall operation finishes successfully, else %FALSE.
+ *
+ * Since: 0.4.
+ */
+gboolean alsactl_card_read_mirrored_elem_value(ALSACtlCard *self, const ALSACtlElemId *elem_id,
+                                               ALSACtlElemValue *const *elem_value,
+                                               GError **error)
+{
+    ALSACtlCardPrivate *priv;
+    struct snd_ctl_elem_value *value;
+    struct elem_value_mirror *mirror;
+    struct elem_value_slot *slot;
+    gboolean present = FALSE;
+    gint seq;
+
+    g_return_val_if_fail(ALSACTL_IS_CARD(self), FALSE);
+    priv = alsactl_card_get_instance_private(self);
+
+    g_return_val_if_fail(elem_id != NULL && elem_id->numid > 0, FALSE);
+    g_return_val_if_fail(elem_value != NULL && ALSACTL_IS_ELEM_VALUE(*elem_value), FALSE);
+    g_return_val_if_fail(error == NULL || *error == NULL, FALSE);
+
+    ctl_elem_value_refer_private(*elem_value, &value);
+
+    // NOTE: The storage is not released till this thread finishes referring to it, since the
+    // pointer is loaded after counting this thread.
+    g_atomic_int_inc(&priv->mirror_readers);
+
+    mirror = g_atomic_pointer_get(&priv->value_mirror);
+    if (mirror == NULL || elem_id->numid >= mirror->slot_count) {
+        g_atomic_int_add(&priv->mirror_readers, -1);
+        generate_local_error(error, ALSACTL_CARD_ERROR_ELEM_NOT_FOUND);
+        return FALSE;
+    }
+    slot = mirror->slots + elem_id->numid;
+
+    do {
+        seq = g_atomic_int_get(&slot->seq);
+        if (seq & 1) {
+            g_thread_yield();
+            continue;
+        }
+
+        present = slot->present;
+        if (present)
+            memcpy(&value->value, slot->value, sizeof(slot->value));
+    } while ((seq & 1) || g_atomic_int_get(&slot->seq) != seq);
+
+    g_atomic_int_add(&priv->mirror_readers, -1);
+
+    if (!present) {
+        generate_local_error(error, ALSACTL_CARD_ERROR_ELEM_NOT_FOUND);
+        return FALSE;
+    }
+
+    value->id = *elem_id;
+
+    return TRUE;
+}
+
+// The lock should be acquired by caller.
+static void schedule_write_src(ALSACtlCardPrivate *priv)
+{
+    CtlCardWriteSource *src = (CtlCardWriteSource *)priv->write_src;
+
+    if (src == NULL || g_source_get_ready_time(priv->write_src) >= 0)
+        return;
+
+    // NOTE: The source is dispatched immediately when the interval already elapsed.
+    g_source_set_ready_time(priv->write_src, src->last_flush + src->interval);
+}
+
+/**
+ * alsactl_card_queue_elem_value:
+ * @self: A [class@Card].
+ * @elem_id: A [struct@ElemId].
+ * @elem_value: A derivative of #ALSACtlElemValue.
+ * @error: A [struct@GLib.Error]. Error is generated with domain of `ALSACtl.CardError`.
+ *
+ * Queue the given value to be written to element indicated by the given identifier later. Just the
+ * latest value is kept for each element, thus intermediate values queued before flush never reach
+ * the element. The queued values are written when the source created by
+ * [method@Card.create_write_source] is dispatched or [method@Card.flush_elem_values] is called,
+ * then [signal@Card::handle-elem-write] signal is emitted for each element.
+ *
+ * When the numeric ID of element is not given, the call of function executes `ioctl(2)` system
+ * call with `SNDRV_CTL_IOCTL_ELEM_INFO` command for ALSA control character device to retrieve it.
+ *
+ * Returns: %TRUE when the overall operation finishes successfully, else %FALSE.
+ *
+ * Since: 0.4.
+ */
+gboolean alsactl_card_queue_elem_value(ALSACtlCard *self, const ALSACtlElemId *elem_id,
+                                       const ALSACtlElemValue *elem_value, GError **error)
+{
+    ALSACtlCardPrivate *priv;
+    struct snd_ctl_elem_value *value;
+    struct snd_ctl_elem_value *entry;
+    struct snd_ctl_elem_id id;
+
+    g_return_val_if_fail(ALSACTL_IS_CARD(self), FALSE);
+    priv = alsactl_card_get_instance_private(self);
+
+    g_return_val_if_fail(elem_id != NULL, FALSE);
+    g_return_val_if_fail(ALSACTL_IS_ELEM_VALUE((ALSACtlElemValue *)elem_value), FALSE);
+    g_return_val_if_fail(error == NULL || *error == NULL, FALSE);
+
+    id = *elem_id;
+    if (id.numid == 0) {
+        struct snd_ctl_elem_info info = {0};
+
+        info.id = id;
+        if (ioctl(priv->fd, SNDRV_CTL_IOCTL_ELEM_INFO, &info) < 0) {
+            if (errno == ENODEV)
+                generate_local_error(error, ALSACTL_CARD_ERROR_DISCONNECTED);
+            else if (errno == ENOENT)
+                generate_local_error(error, ALSACTL_CARD_ERROR_ELEM_NOT_FOUND);
+            else
+                generate_syscall_error(error, errno, "ioctl(%s)", "ELEM_INFO");
+            return FALSE;
+        }
+        id = info.id;
+    }
+
+    ctl_elem_value_refer_private((ALSACtlElemValue *)elem_value, &value);
+
+    g_mutex_lock(&priv->write_lock);
+
+    entry = g_hash_table_lookup(priv->pending_write_table, GUINT_TO_POINTER(id.numid));
+    if (entry == NULL) {
+        entry = g_malloc(sizeof(*entry));
+        g_queue_push_tail(&priv->pending_writes, entry);
+        g_hash_table_insert(priv->pending_write_table, GUINT_TO_POINTER(id.numid), entry);
+    }
+    *entry = *value;
+    entry->id = id;
+
+    schedule_write_src(priv);
+
+    g_mutex_unlock(&priv->write_lock);
+
+    return TRUE;
+}
+
+static gboolean flush_pending_writes(ALSACtlCard *self, ALSACtlCardPrivate *priv, GError **error)
+{
+    GQueue entries;
+    struct snd_ctl_elem_value *entry;
+    gboolean result = TRUE;
+
+    // NOTE: The flush lock is held across the system calls so that flushes in several threads
+    // are serialized, thus the latest queued value reaches the element at last. It is recursive
+    // so that the handler of signal can flush again. The write lock is not held during system
+    // calls to allow threads to queue values.
+    g_rec_mutex_lock(&priv->flush_lock);
+
+    g_mutex_lock(&priv->write_lock);
+    entries = priv->pending_writes;
+    g_queue_init(&priv->pending_writes);
+    g_hash_table_remove_all(priv->pending_write_table);
+    g_mutex_unlock(&priv->write_lock);
+
+    while ((entry = g_queue_pop_head(&entries)) != NULL) {
+        GError *local_error = NULL;
+
+        if (ioctl(priv->fd, SNDRV_CTL_IOCTL_ELEM_WRITE, entry) < 0) {
+            if (errno == ENODEV)
+                generate_local_error(&local_error, ALSACTL_CARD_ERROR_DISCONNECTED);
+            else if (errno == ENOENT)
+                generate_local_error(&local_error, ALSACTL_CARD_ERROR_ELEM_NOT_FOUND);
+            else if (errno == EPERM)
+                generate_local_error(&local_error, ALSACTL_CARD_ERROR_ELEM_NOT_SUPPORTED);
+            else
+                generate_syscall_error(&local_error, errno, "ioctl(%s)", "ELEM_WRITE");
+        }
+
+        g_signal_emit(self, ctl_card_sigs[CTL_CARD_SIG_HANDLE_ELEM_WRITE], 0,
+                      &entry->id, local_error);
+
+        if (local_error != NULL) {
+            if (result)
+                g_propagate_error(error, local_error);
+            else
+                g_error_free(local_error);
+            result = FALSE;
+        }
+
+        g_free(entry);
+    }
+
+    g_rec_mutex_unlock(&priv->flush_lock);
+
+    return result;
+}
+
+/**
+ * alsactl_card_flush_elem_values:
+ * @self: A [class@Card].
+ * @error: A [struct@GLib.Error]. Error is generated with domain of `ALSACtl.CardError`.
+ *
+ * Write all of values queued by [method@Card.queue_elem_value] in the calling thread, then emit
+ * [signal@Card::handle-elem-write] signal for each element. The first failure is reported by the
+ * error argument as well. The call is serialized against the other flush in any thread, including
+ * the dispatch of source created by [method@Card.create_write_source].
+ *
+ * The call of function executes `ioctl(2)` system call with `SNDRV_CTL_IOCTL_ELEM_WRITE` command
+ * for ALSA control character device for each queued value.
+ *
+ * Returns: %TRUE when the overall operation finishes successfully, else %FALSE.
+ *
+ * Since: 0.4.
+ */
+gboolean alsactl_card_flush_elem_values(ALSACtlCard *self, GError **error)
+{
+    ALSACtlCardPrivate *priv;
+
+    g_return_val_if_fail(ALSACTL_IS_CARD(self), FALSE);
+    priv = alsactl_card_get_instance_private(self);
+    g_return_val_if_fail(priv->fd >= 0, FALSE);
+
+    g_return_val_if_fail(error == NULL || *error == NULL, FALSE);
+
+    return flush_pending_writes(self, priv, error);
+}
+
+static gboolean ctl_card_dispatch_write_src(GSource *gsrc, GSourceFunc cb, gpointer user_data)
+{
+    CtlCardWriteSource *src = (CtlCardWriteSource *)gsrc;
+    ALSACtlCard *self = src->self;
+    ALSACtlCardPrivate *priv = alsactl_card_get_instance_private(self);
+
+    if (priv->fd < 0)
+        return G_SOURCE_REMOVE;
+
+    g_mutex_lock(&priv->write_lock);
+    g_source_set_ready_time(gsrc, -1);
+    src->last_flush = g_source_get_time(gsrc);
+    g_mutex_unlock(&priv->write_lock);
+
+    flush_pending_writes(self, priv, NULL);
+
+    // Just be sure to continue to process this source.
+    return G_SOURCE_CONTINUE;
+}
+
+static void ctl_card_finalize_write_src(GSource *gsrc)
+{
+    CtlCardWriteSource *src = (CtlCardWriteSource *)gsrc;
+    ALSACtlCardPrivate *priv = alsactl_card_get_instance_private(src->self);
+
+    g_mutex_lock(&priv->write_lock);
+    priv->write_src = NULL;
+    g_mutex_unlock(&priv->write_lock);
+
+    g_object_unref(src->self);
+}
+
+/**
+ * alsactl_card_create_write_source:
+ * @self: A [class@Card].
+ * @interval: The minimum interval between flushes in millisecond unit.
+ * @gsrc: (out): A [struct@GLib.Source] to write values queued by [method@Card.queue_elem_value].
+ * @error: A [struct@GLib.Error]. Error is generated with domain of `ALSACtl.CardError`.
+ *
+ * Allocate [struct@GLib.Source] structure to write values queued by [method@Card.queue_elem_value].
+ * The source is dispatched when any value is queued, at most once within the given interval, to
+ * write all of queued values, then [signal@Card::handle-elem-write] signal is emitted for each
+ * element. Attaching the source to [struct@GLib.MainContext] iterated by the dedicated thread
+ * allows the thread to queue values not to be blocked by the driver. Just one source is
+ * available for the instance at the same time.
+ *
+ * Returns: %TRUE when the overall operation finishes successfully, else %FALSE.
+ *
+ * Since: 0.4.
+ */
+gboolean alsactl_card_create_write_source(ALSACtlCard *self, guint interval, GSource **gsrc,
+                                          GError **error)
+{
+    static GSourceFuncs funcs = {
+            .dispatch       = ctl_card_dispatch_write_src,
+            .finalize       = ctl_card_finalize_write_src,
+    };
+    ALSACtlCardPrivate *priv;
+    CtlCardWriteSource *src;
+
+    g_return_val_if_fail(ALSACTL_IS_CARD(self), FALSE);
+    priv = alsactl_card_get_instance_private(self);
+    g_return_val_if_fail(priv->fd >= 0, FALSE);
+
+    g_return_val_if_fail(gsrc != NULL, FALSE);
+    g_return_val_if_fail(error == NULL || *error == NULL, FALSE);
+
+    *gsrc = g_source_new(&funcs, sizeof(CtlCardWriteSource));
+    src = (CtlCardWriteSource *)(*gsrc);
+
+    g_source_set_name(*gsrc, "ALSACtlCardWrite");
+    g_source_set_priority(*gsrc, G_PRIORITY_HIGH_IDLE);
+
+    src->self = g_object_ref(self);
+    src->interval = (gint64)interval * 1000;
+    src->last_flush = 0;
+
+    g_mutex_lock(&priv->write_lock);
+    if (priv->write_src != NULL) {
+        g_mutex_unlock(&priv->write_lock);
+        g_source_unref(*gsrc);
+        *gsrc = NULL;
+        g_return_val_if_reached(FALSE);
+    }
+    priv->write_src = *gsrc;
+    if (!g_queue_is_empty(&priv->pending_writes))
+        schedule_write_src(priv);
+    g_mutex_unlock(&priv->write_lock);
+
+    return TRUE;
+}
+
+// NOTE: The numeric ID is not used for hash and equality since it is the value to look up.
+static guint elem_name_hash(gconstpointer key)
+{
+    const struct snd_ctl_elem_id *id = key;
+
+    return g_str_hash((const char *)id->name) ^ (id->iface << 24) ^ (id->device << 16) ^
+           (id->subdevice << 8) ^ id->index;
+}
+
+static gboolean elem_name_equal(gconstpointer a, gconstpointer b)
+{
+    const struct snd_ctl_elem_id *lhs = a;
+    const struct snd_ctl_elem_id *rhs = b;
+
+    return lhs->iface == rhs->iface &&
+           lhs->device == rhs->device &&
+           lhs->subdevice == rhs->subdevice &&
+           lhs->index == rhs->index &&
+           !strcmp((const char *)lhs->name, (const char *)rhs->name);
+}
+
+static void insert_elem_name_index(GHashTable *name_index, const struct snd_ctl_elem_id *id)
+{
+    struct snd_ctl_elem_id *entry = g_malloc(sizeof(*entry));
+
+    *entry = *id;
+
+    // NOTE: The key and the value are the same storage.
+    g_hash_table_replace(name_index, entry, entry);
+}
+
+// The lock should be acquired by caller.
+static gboolean build_elem_name_index(ALSACtlCardPrivate *priv, GError **error)
+{
+    struct snd_ctl_elem_list list = {0};
+    int i;
+
+    if (!allocate_elem_ids(priv->fd, &list, error))
+        return FALSE;
+
+    priv->name_index = g_hash_table_new_full(elem_name_hash, elem_name_equal, g_free, NULL);
+    for (i = 0; i < list.count; ++i)
+        insert_elem_name_index(priv->name_index, list.pids + i);
+
+    deallocate_elem_ids(&list);
+
+    return TRUE;
+}
+
+static void update_elem_name_index(ALSACtlCardPrivate *priv, const struct snd_ctl_elem_id *id,
+                                   unsigned int mask)
+{
+    g_mutex_lock(&priv->name_index_lock);
+
+    if (priv->name_index != NULL) {
+        if (mask == SNDRV_CTL_EVENT_MASK_REMOVE)
+            g_hash_table_remove(priv->name_index, id);
+        else if (mask & SNDRV_CTL_EVENT_MASK_ADD)
+            insert_elem_name_index(priv->name_index, id);
+    }
+
+    g_mutex_unlock(&priv->name_index_lock);
+}
+
+/**
+ * alsactl_card_find_elem_id:
+ * @self: A [class@Card].
+ * @iface: The interface of element, one of ALSACtlElemIfaceType.
+ * @device_id: The numeric identifier of device to which the element belongs.
+ * @subdevice_id: The numeric identifier of subdevice to which the element belongs.
+ * @name: The name of element.
+ * @index: The index of element in a set of elements with the same name.
+ * @elem_id: (out): A [struct@ElemId] including the numeric ID of element.
+ * @error: A [struct@GLib.Error]. Error is generated with domain of `ALSACtl.CardError`.
+ *
+ * Find the element by the name and the other fields of identifier.
+ *
+ * While the instance is subscribed for event by [method@Card.create_source], the index of
+ * identifiers keyed by the name and the other fields is built once at the first call, and kept
+ * current by the event with [flags@ElemEventMask] for `ADD` and `REMOVE`. Then the call of function
+ * executes no system call. The index is released when the last source is released.
+ *
+ * The call of function executes `ioctl(2)` system call with `SNDRV_CTL_IOCTL_ELEM_LIST` command to
+ * build the index, or `SNDRV_CTL_IOCTL_ELEM_INFO` command without subscription, for ALSA control
+ * character device.
+ *
+ * Returns: %TRUE when the overall operation finishes successfully, else %FALSE.
+ *
+ * Since: 0.4.
+ */
+gboolean alsactl_card_find_elem_id(ALSACtlCard *self, ALSACtlElemIfaceType iface, guint device_id,
+                                   guint subdevice_id, const gchar *name, guint index,
+                                   ALSACtlElemId **elem_id, GError **error)
+{
+    ALSACtlCardPrivate *priv;
+    struct snd_ctl_elem_id id = {0};
+    const struct snd_ctl_elem_id *entry;
+
+    g_return_val_if_fail(ALSACTL_IS_CARD(self), FALSE);
+    priv = alsactl_card_get_instance_private(self);
+    g_return_val_if_fail(priv->fd >= 0, FALSE);
+
+    g_return_val_if_fail(name != NULL && strlen(name) > 0, FALSE);
+    g_return_val_if_fail(elem_id != NULL, FALSE);
+    g_return_val_if_fail(error == NULL || *error == NULL, FALSE);
+
+    id.iface = iface;
+    id.device = device_id;
+    id.subdevice = subdevice_id;
+    g_strlcpy((char *)id.name, name, sizeof(id.name));
+    id.index = index;
+
+    // NOTE: The index can not be kept current without subscription of event.
+    if (g_atomic_int_get(&priv->subscribers) == 0) {
+        struct snd_ctl_elem_info info = {0};
+
+        info.id = id;
+        if (ioctl(priv->fd, SNDRV_CTL_IOCTL_ELEM_INFO, &info) < 0) {
+            if (errno == ENODEV)
+                generate_local_error(error, ALSACTL_CARD_ERROR_DISCONNECTED);
+            else if (errno == ENOENT)
+                generate_local_error(error, ALSACTL_CARD_ERROR_ELEM_NOT_FOUND);
+            else
+                generate_syscall_error(error, errno, "ioctl(%s)", "ELEM_INFO");
+            return FALSE;
+        }
+
+        *elem_id = g_boxed_copy(ALSACTL_TYPE_ELEM_ID, &info.id);
+        return TRUE;
+    }
+
+    g_mutex_lock(&priv->name_index_lock);
+
+    if (priv->name_index == NULL && !build_elem_name_index(priv, error)) {
+        g_mutex_unlock(&priv->name_index_lock);
+        return FALSE;
+    }
+
+    entry = g_hash_table_lookup(priv->name_index, &id);
+    if (entry != NULL)
+        *elem_id = g_boxed_copy(ALSACTL_TYPE_ELEM_ID, entry);
+
+    g_mutex_unlock(&priv->name_index_lock);
+
+    if (entry == NULL) {
+        generate_local_error(error, ALSACTL_CARD_ERROR_ELEM_NOT_FOUND);
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+static void handle_elem_event(CtlCardSource *src, struct snd_ctl_event *ev)
+{
+    ALSACtlCard *self = src->self;
+    ALSACtlCardPrivate *priv = alsactl_card_get_instance_private(self);
+    ALSACtlElemId *elem_id;
+    ALSACtlElemEventMask mask;
+
+    elem_id = &ev->data.elem.id;
+
+    // Invalidate cached information before emitting signal so that handlers can retrieve the
+    // latest one.
+    if (ev->data.elem.mask == SNDRV_CTL_EVENT_MASK_REMOVE ||
+        ev->data.elem.mask & (SNDRV_CTL_EVENT_MASK_INFO | SNDRV_CTL_EVENT_MASK_TLV)) {
+        g_mutex_lock(&priv->cache_lock);
+        ++priv->cache_generation;
+        drop_cached_elem_info(priv, elem_id->numid);
+        g_mutex_unlock(&priv->cache_lock);
+    }
+
+    update_elem_value_mirror(priv, elem_id->numid, ev->data.elem.mask);
+    update_elem_name_index(priv, elem_id, ev->data.elem.mask);
+
+    if (ev->data.elem.mask != SNDRV_CTL_EVENT_MASK_REMOVE)
+        mask = ev->data.elem.mask;
+    else
+        mask = ALSACTL_ELEM_EVENT_MASK_REMOVE;
+
+    g_signal_emit(self, ctl_card_sigs[CTL_CARD_SIG_HANDLE_ELEM_EVENT], 0,
+                  elem_id, mask);
+}
+
+static gboolean ctl_card_check_src(GSource *gsrc)
+{
+    CtlCardSource *src = (CtlCardSource *)gsrc;
+    GIOCondition condition;
+
+    // Don't go to dispatch if nothing available. As an exception, return TRUE
+    // for POLLERR to call .dispatch for internal destruction.
+    condition = g_source_query_unix_fd(gsrc, src->tag);
+    return !!(condition & (G_IO_IN | G_IO_ERR));
+}
+
+// NOTE: The batch is bounded by the size of page, thus linear search is enough.
+static unsigned int coalesce_elem_events(struct snd_ctl_event *events, unsigned int count)
+{
+    unsigned int kept_count = 0;
+    unsigned int i, j;
+
+    for (i = 0; i < count; ++i) {
+        struct snd_ctl_event *ev = events + i;
+        struct snd_ctl_event *prev = NULL;
+
+        if (ev->type == SNDRV_CTL_EVENT_ELEM) {
+            for (j = kept_count; j > 0; --j) {
+                struct snd_ctl_event *entry = events + j - 1;
+
+                if (entry->type == SNDRV_CTL_EVENT_ELEM &&
+                    entry->data.elem.id.numid == ev->data.elem.id.numid) {
+                    // The element added after removal is not the same one.
+                    if (entry->data.elem.mask != SNDRV_CTL_EVENT_MASK_REMOVE)
+                        prev = entry;
+                    break;
+                }
+            }
+        }
+
+        if (prev != NULL) {
+            if (ev->data.elem.mask == SNDRV_CTL_EVENT_MASK_REMOVE)
+                prev->data.elem.mask = SNDRV_CTL_EVENT_MASK_REMOVE;
+            else
+                prev->data.elem.mask |= ev->data.elem.mask;
+        } else {
+            if (kept_count != i)
+                events[kept_count] = *ev;
+            ++kept_count;
+        }
+    }
+
+    return kept_count;
+}
+
+static gboolean ctl_card_dispatch_src(GSource *gsrc, GSourceFunc cb,
+                                      gpointer user_data)
+{
+    CtlCardSource *src = (CtlCardSource *)gsrc;
+    ALSACtlCard *self = src->self;
+    ALSACtlCardPrivate *priv;
+    GIOCondition condition;
+    int len;
+    struct snd_ctl_event *ev;
+    unsigned int count;
+    unsigned int i;
+
+    priv = alsactl_card_get_instance_private(self);
     if (priv->fd < 0)
         return G_SOURCE_REMOVE;
 
@@ -1184,12 +2803,23 @@ static gboolean ctl_card_dispatch_src(GSource *gsrc, GSourceFunc cb,
     }
 
     ev = src->buf;
-    while (len >= sizeof(*ev)) {
-        if (ev->type == SNDRV_CTL_EVENT_ELEM)
-            handle_elem_event(src, ev);
+    count = len / sizeof(*ev);
+
+    for (i = 0; i < count; ++i) {
+        if (ev[i].type == SNDRV_CTL_EVENT_ELEM)
+            ++priv->received_elem_event_count;
+    }
 
-        len -= sizeof(*ev);
-        ++ev;
+    if (priv->coalesce_elem_events) {
+        unsigned int kept_count = coalesce_elem_events(ev, count);
+
+        priv->coalesced_elem_event_count += count - kept_count;
+        count = kept_count;
+    }
+
+    for (i = 0; i < count; ++i) {
+        if (ev[i].type == SNDRV_CTL_EVENT_ELEM)
+            handle_elem_event(src, ev + i);
     }
 
     // Just be sure to continue to process this source.
@@ -1205,6 +2835,21 @@ static void ctl_card_finalize_src(GSource *gsrc)
     if (g_atomic_int_dec_and_test(&priv->subscribers)) {
         int subscribe = 0;
         ioctl(priv->fd, SNDRV_CTL_IOCTL_SUBSCRIBE_EVENTS, &subscribe);
+
+        g_mutex_lock(&priv->cache_lock);
+        drop_all_cached_elem_infos(priv);
+        g_mutex_unlock(&priv->cache_lock);
+
+        g_mutex_lock(&priv->mirror_write_lock);
+        replace_elem_value_mirror(priv, NULL);
+        g_mutex_unlock(&priv->mirror_write_lock);
+
+        g_mutex_lock(&priv->name_index_lock);
+        if (priv->name_index != NULL) {
+            g_hash_table_destroy(priv->name_index);
+            priv->name_index = NULL;
+        }
+        g_mutex_unlock(&priv->name_index_lock);
     }
 
     g_free(src->buf);
@@ -35,6 +35,19 @@ struct _ALSACtlCardClass {
      * Class closure for the [signal@Card::handle-disconnection] signal.
      */
     void (*handle_disconnection)(ALSACtlCard *self);
+
+    /**
+     * ALSACtlCardClass::handle_elem_write:
+     * @self: A [class@Card].
+     * @elem_id: (transfer none): A [struct@ElemId].
+     * @error: (transfer none)(nullable): A [struct@GLib.Error] when the write operation failed.
+     *
+     * Class closure for the [signal@Card::handle-elem-write] signal.
+     *
+     * Since: 0.4.
+     */
+    void (*handle_elem_write)(ALSACtlCard *self, const ALSACtlElemId *elem_id,
+                              const GError *error);
 };
 
 ALSACtlCard *alsactl_card_new();
@@ -47,6 +60,12 @@ gboolean alsactl_card_get_protocol_version(ALSACtlCard *self, const guint16 *pro
 gboolean alsactl_card_get_info(ALSACtlCard *self, ALSACtlCardInfo **card_info, GError **error);
 
 gboolean alsactl_card_get_elem_id_list(ALSACtlCard *self, GList **entries, GError **error);
+gboolean alsactl_card_get_elem_id_array(ALSACtlCard *self, ALSACtlElemId **entries,
+                                        gsize *entry_count, GError **error);
+
+gboolean alsactl_card_find_elem_id(ALSACtlCard *self, ALSACtlElemIfaceType iface, guint device_id,
+                                   guint subdevice_id, const gchar *name, guint index,
+                                   ALSACtlElemId **elem_id, GError **error);
 
 gboolean alsactl_card_lock_elem(ALSACtlCard *self, const ALSACtlElemId *elem_id, gboolean lock,
                                 GError **error);
@@ -74,6 +93,33 @@ gboolean alsactl_card_write_elem_value(ALSACtlCard *self, const ALSACtlElemId *e
                                        const ALSACtlElemValue *elem_value, GError **error);
 gboolean alsactl_card_read_elem_value(ALSACtlCard *self, const ALSACtlElemId *elem_id,
                                       ALSACtlElemValue *const *elem_value, GError **error);
+gboolean alsactl_card_write_elem_compact_value(ALSACtlCard *self, const ALSACtlElemId *elem_id,
+                                               const ALSACtlCompactElemValue *elem_value,
+                                               GError **error);
+gboolean alsactl_card_read_elem_compact_value(ALSACtlCard *self, const ALSACtlElemId *elem_id,
+                                              ALSACtlCompactElemValue *const *elem_value,
+                                              GError **error);
+
+gboolean alsactl_card_write_elem_values(ALSACtlCard *self, const ALSACtlElemId *elem_ids,
+                                        gsize elem_count, const guint8 *values,
+                                        gsize values_length, guint worker_count, gint *statuses,
+                                        GError **error);
+gboolean alsactl_card_read_elem_values(ALSACtlCard *self, const ALSACtlElemId *elem_ids,
+                                       gsize elem_count, guint8 *const *values,
+                                       gsize values_length, guint worker_count, gint *statuses,
+                                       GError **error);
+
+gboolean alsactl_card_start_value_mirror(ALSACtlCard *self, GError **error);
+void alsactl_card_stop_value_mirror(ALSACtlCard *self);
+gboolean alsactl_card_read_mirrored_elem_value(ALSACtlCard *self, const ALSACtlElemId *elem_id,
+                                               ALSACtlElemValue *const *elem_value,
+                                               GError **error);
+
+gboolean alsactl_card_queue_elem_value(ALSACtlCard *self, const ALSACtlElemId *elem_id,
+                                       const ALSACtlElemValue *elem_value, GError **error);
+gboolean alsactl_card_flush_elem_values(ALSACtlCard *self, GError **error);
+gboolean alsactl_card_create_write_source(ALSACtlCard *self, guint interval, GSource **gsrc,
+                                          GError **error);
 
 gboolean alsactl_card_create_source(ALSACtlCard *self, GSource **gsrc, GError **error);
 
@@ -0,0 +1,468 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+#include "privates.h"
+
+/**
+ * ALSACtlCompactElemValue:
+ * A boxed object to express the container of values sized to the element.
+ *
+ * A [struct@CompactElemValue] is a lightweight alternative to [class@ElemValue]. It is allocated
+ * once according to the type of element and the number of values in the element, and has no
+ * storage except for the values in the layout of `value` member in `struct snd_ctl_elem_value` in
+ * UAPI of Linux sound subsystem. The object is used for the call of
+ * [method@Card.write_elem_compact_value] and [method@Card.read_elem_compact_value].
+ *
+ * Since: 0.4.
+ */
+struct _ALSACtlCompactElemValue {
+    ALSACtlElemType elem_type;
+    gsize value_count;
+    gsize size;
+    // NOTE: 64 bit storage for alignment of long long type.
+    gint64 storage[];
+};
+
+static ALSACtlCompactElemValue *ctl_compact_elem_value_copy(const ALSACtlCompactElemValue *self)
+{
+    gsize size = sizeof(*self) + self->size;
+    ALSACtlCompactElemValue *dst = g_malloc(size);
+
+    memcpy(dst, self, size);
+
+    return dst;
+}
+
+G_DEFINE_BOXED_TYPE(ALSACtlCompactElemValue, alsactl_compact_elem_value,
+                    ctl_compact_elem_value_copy, g_free);
+
+static gsize compute_storage_size(ALSACtlElemType elem_type, gsize value_count)
+{
+    struct snd_ctl_elem_value *value = NULL;
+
+    switch (elem_type) {
+    case ALSACTL_ELEM_TYPE_BOOLEAN:
+    case ALSACTL_ELEM_TYPE_INTEGER:
+        g_return_val_if_fail(value_count <= G_N_ELEMENTS(value->value.integer.value), 0);
+        return sizeof(*value->value.integer.value) * value_count;
+    case ALSACTL_ELEM_TYPE_ENUMERATED:
+        g_return_val_if_fail(value_count <= G_N_ELEMENTS(value->value.enumerated.item), 0);
+        return sizeof(*value->value.enumerated.item) * value_count;
+    case ALSACTL_ELEM_TYPE_BYTES:
+        g_return_val_if_fail(value_count <= G_N_ELEMENTS(value->value.bytes.data), 0);
+        return sizeof(*value->value.bytes.data) * value_count;
+    case ALSACTL_ELEM_TYPE_IEC60958:
+        g_return_val_if_fail(value_count == 1, 0);
+        return sizeof(value->value.iec958);
+    case ALSACTL_ELEM_TYPE_INTEGER64:
+        g_return_val_if_fail(value_count <= G_N_ELEMENTS(value->value.integer64.value), 0);
+        return sizeof(*value->value.integer64.value) * value_count;
+    default:
+        g_return_val_if_reached(0);
+    }
+}
+
+/**
+ * alsactl_compact_elem_value_new:
+ * @elem_type: The type of element, one of [enum@ElemType] except for NONE.
+ * @value_count: The number of values in the element; up to 128 for BOOLEAN, INTEGER, and
+ *               ENUMERATED, up to 512 for BYTES, up to 64 for INTEGER64, and 1 for IEC60958.
+ *
+ * Allocate and return an instance of [struct@CompactElemValue] sized to the element.
+ *
+ * Returns: A [struct@CompactElemValue].
+ *
+ * Since: 0.4.
+ */
+ALSACtlCompactElemValue *alsactl_compact_elem_value_new(ALSACtlElemType elem_type,
+                                                        gsize value_count)
+{
+    ALSACtlCompactElemValue *self;
+    gsize size;
+
+    g_return_val_if_fail(value_count > 0, NULL);
+
+    size = compute_storage_size(elem_type, value_count);
+    g_return_val_if_fail(size > 0, NULL);
+
+    size = (size + sizeof(*self->storage) - 1) / sizeof(*self->storage) * sizeof(*self->storage);
+
+    self = g_malloc0(sizeof(*self) + size);
+    self->elem_type = elem_type;
+    self->value_count = value_count;
+    self->size = size;
+
+    return self;
+}
+
+/**
+ * alsactl_compact_elem_value_get_elem_type:
+ * @self: A [struct@CompactElemValue].
+ * @elem_type: (out): The type of element, one of [enum@ElemType].
+ *
+ * Get the type of element.
+ *
+ * Since: 0.4.
+ */
+void alsactl_compact_elem_value_get_elem_type(const ALSACtlCompactElemValue *self,
+                                              ALSACtlElemType *elem_type)
+{
+    g_return_if_fail(self != NULL);
+    g_return_if_fail(elem_type != NULL);
+
+    *elem_type = self->elem_type;
+}
+
+/**
+ * alsactl_compact_elem_value_get_value_count:
+ * @self: A [struct@CompactElemValue].
+ * @value_count: (out): The number of values in the element.
+ *
+ * Get the number of values in the element.
+ *
+ * Since: 0.4.
+ */
+void alsactl_compact_elem_value_get_value_count(const ALSACtlCompactElemValue *self,
+                                                gsize *value_count)
+{
+    g_return_if_fail(self != NULL);
+    g_return_if_fail(value_count != NULL);
+
+    *value_count = self->value_count;
+}
+
+/**
+ * alsactl_compact_elem_value_set_bool:
+ * @self: A [struct@CompactElemValue].
+ * @values: (array length=value_count): The array for boolean values.
+ * @value_count: The number of values up to the number of values in the element.
+ *
+ * Copy the array into the storage for [enum@ElemType].BOOLEAN element.
+ *
+ * Since: 0.4.
+ */
+void alsactl_compact_elem_value_set_bool(ALSACtlCompactElemValue *self, const gboolean *values,
+                                         gsize value_count)
+{
+    long *storage;
+    int i;
+
+    g_return_if_fail(self != NULL);
+    g_return_if_fail(self->elem_type == ALSACTL_ELEM_TYPE_BOOLEAN);
+    g_return_if_fail(values != NULL);
+
+    storage = (long *)self->storage;
+    value_count = MIN(value_count, self->value_count);
+    for (i = 0; i < value_count; ++i)
+        storage[i] = values[i] > 0;
+}
+
+/**
+ * alsactl_compact_elem_value_get_bool:
+ * @self: A [struct@CompactElemValue].
+ * @values: (array length=value_count)(inout): The array for boolean values.
+ * @value_count: The number of values in the array. The number of copied values is returned.
+ *
+ * Copy the values of [enum@ElemType].BOOLEAN element into the given array.
+ *
+ * Since: 0.4.
+ */
+void alsactl_compact_elem_value_get_bool(const ALSACtlCompactElemValue *self,
+                                         gboolean *const *values, gsize *value_count)
+{
+    const long *storage;
+    int i;
+
+    g_return_if_fail(self != NULL);
+    g_return_if_fail(self->elem_type == ALSACTL_ELEM_TYPE_BOOLEAN);
+    g_return_if_fail(values != NULL && *values != NULL);
+    g_return_if_fail(value_count != NULL);
+
+    storage = (const long *)self->storage;
+    *value_count = MIN(*value_count, self->value_count);
+    for (i = 0; i < *value_count; ++i)
+        (*values)[i] = storage[i] > 0;
+}
+
+/**
+ * alsactl_compact_elem_value_set_int:
+ * @self: A [struct@CompactElemValue].
+ * @values: (array length=value_count): The array for 32 bit signed integer values.
+ * @value_count: The number of values up to the number of values in the element.
+ *
+ * Copy the array into the storage for [enum@ElemType].INTEGER element.
+ *
+ * Since: 0.4.
+ */
+void alsactl_compact_elem_value_set_int(ALSACtlCompactElemValue *self, const gint32 *values,
+                                        gsize value_count)
+{
+    long *storage;
+    int i;
+
+    g_return_if_fail(self != NULL);
+    g_return_if_fail(self->elem_type == ALSACTL_ELEM_TYPE_INTEGER);
+    g_return_if_fail(values != NULL);
+
+    storage = (long *)self->storage;
+    value_count = MIN(value_count, self->value_count);
+    for (i = 0; i < value_count; ++i)
+        storage[i] = (long)values[i];
+}
+
+/**
+ * alsactl_compact_elem_value_get_int:
+ * @self: A [struct@CompactElemValue].
+ * @values: (array length=value_count)(inout): The array for 32 bit signed integer values.
+ * @value_count: The number of values in the array. The number of copied values is returned.
+ *
+ * Copy the values of [enum@ElemType].INTEGER element into the given array.
+ *
+ * Since: 0.4.
+ */
+void alsactl_compact_elem_value_get_int(const ALSACtlCompactElemValue *self,
+                                        gint32 *const *values, gsize *value_count)
+{
+    const long *storage;
+    int i;
+
+    g_return_if_fail(self != NULL);
+    g_return_if_fail(self->elem_type == ALSACTL_ELEM_TYPE_INTEGER);
+    g_return_if_fail(values != NULL && *values != NULL);
+    g_return_if_fail(value_count != NULL);
+
+    storage = (const long *)self->storage;
+    *value_count = MIN(*value_count, self->value_count);
+    for (i = 0; i < *value_count; ++i)
+        (*values)[i] = (gint32)storage[i];
+}
+
+/**
+ * alsactl_compact_elem_value_set_enum:
+ * @self: A [struct@CompactElemValue].
+ * @values: (array length=value_count): The array for enumeration index values.
+ * @value_count: The number of values up to the number of values in the element.
+ *
+ * Copy the array into the storage for [enum@ElemType].ENUMERATED element.
+ *
+ * Since: 0.4.
+ */
+void alsactl_compact_elem_value_set_enum(ALSACtlCompactElemValue *self, const guint32 *values,
+                                         gsize value_count)
+{
+    g_return_if_fail(self != NULL);
+    g_return_if_fail(self->elem_type == ALSACTL_ELEM_TYPE_ENUMERATED);
+    g_return_if_fail(values != NULL);
+
+    value_count = MIN(value_count, self->value_count);
+    memcpy(self->storage, values, sizeof(*values) * value_count);
+}
+
+/**
+ * alsactl_compact_elem_value_get_enum:
+ * @self: A [struct@CompactElemValue].
+ * @values: (array length=value_count)(out)(transfer none): The array for enumeration index values.
+ * @value_count: (out): The number of values in the element.
+ *
+ * Refer to the storage for [enum@ElemType].ENUMERATED element.
+ *
+ * Since: 0.4.
+ */
+void alsactl_compact_elem_value_get_enum(const ALSACtlCompactElemValue *self,
+                                         const guint32 **values, gsize *value_count)
+{
+    g_return_if_fail(self != NULL);
+    g_return_if_fail(self->elem_type == ALSACTL_ELEM_TYPE_ENUMERATED);
+    g_return_if_fail(values != NULL);
+    g_return_if_fail(value_count != NULL);
+
+    *values = (const guint32 *)self->storage;
+    *value_count = self->value_count;
+}
+
+/**
+ * alsactl_compact_elem_value_set_bytes:
+ * @self: A [struct@CompactElemValue].
+ * @values: (array length=value_count): The array for 8 bit unsigned integer values.
+ * @value_count: The number of values up to the number of values in the element.
+ *
+ * Copy the array into the storage for [enum@ElemType].BYTES element.
+ *
+ * Since: 0.4.
+ */
+void alsactl_compact_elem_value_set_bytes(ALSACtlCompactElemValue *self, const guint8 *values,
+                                          gsize value_count)
+{
+    g_return_if_fail(self != NULL);
+    g_return_if_fail(self->elem_type == ALSACTL_ELEM_TYPE_BYTES);
+    g_return_if_fail(values != NULL);
+
+    value_count = MIN(value_count, self->value_count);
+    memcpy(self->storage, values, value_count);
+}
+
+/**
+ * alsactl_compact_elem_value_get_bytes:
+ * @self: A [struct@CompactElemValue].
+ * @values: (array length=value_count)(out)(transfer none): The array for 8 bit unsigned integer
+ *          values.
+ * @value_count: (out): The number of values in the element.
+ *
+ * Refer to the storage for [enum@ElemType].BYTES element.
+ *
+ * Since: 0.4.
+ */
+void alsactl_compact_elem_value_get_bytes(const ALSACtlCompactElemValue *self,
+                                          const guint8 **values, gsize *value_count)
+{
+    g_return_if_fail(self != NULL);
+    g_return_if_fail(self->elem_type == ALSACTL_ELEM_TYPE_BYTES);
+    g_return_if_fail(values != NULL);
+    g_return_if_fail(value_count != NULL);
+
+    *values = (const guint8 *)self->storage;
+    *value_count = self->value_count;
+}
+
+/**
+ * alsactl_compact_elem_value_set_int64:
+ * @self: A [struct@CompactElemValue].
+ * @values: (array length=value_count): The array for 64 bit signed integer values.
+ * @value_count: The number of values up to the number of values in the element.
+ *
+ * Copy the array into the storage for [enum@ElemType].INTEGER64 element.
+ *
+ * Since: 0.4.
+ */
+void alsactl_compact_elem_value_set_int64(ALSACtlCompactElemValue *self, const gint64 *values,
+                                          gsize value_count)
+{
+    g_return_if_fail(self != NULL);
+    g_return_if_fail(self->elem_type == ALSACTL_ELEM_TYPE_INTEGER64);
+    g_return_if_fail(values != NULL);
+
+    value_count = MIN(value_count, self->value_count);
+    memcpy(self->storage, values, sizeof(*values) * value_count);
+}
+
+/**
+ * alsactl_compact_elem_value_get_int64:
+ * @self: A [struct@CompactElemValue].
+ * @values: (array length=value_count)(out)(transfer none): The array for 64 bit signed integer
+ *          values.
+ * @value_count: (out): The number of values in the element.
+ *
+ * Refer to the storage for [enum@ElemType].INTEGER64 element.
+ *
+ * Since: 0.4.
+ */
+void alsactl_compact_elem_value_get_int64(const ALSACtlCompactElemValue *self,
+                                          const gint64 **values, gsize *value_count)
+{
+    g_return_if_fail(self != NULL);
+    g_return_if_fail(self->elem_type == ALSACTL_ELEM_TYPE_INTEGER64);
+    g_return_if_fail(values != NULL);
+    g_return_if_fail(value_count != NULL);
+
+    *values = self->storage;
+    *value_count = self->value_count;
+}
+
+/**
+ * alsactl_compact_elem_value_set_iec60958_channel_status:
+ * @self: A [struct@CompactElemValue].
+ * @status: (array length=length): The array of byte data for channel status bits of IEC 60958.
+ * @length: The number of bytes in status argument, up to 24.
+ *
+ * Copy the channel status bits into the storage for [enum@ElemType].IEC60958 element.
+ *
+ * Since: 0.4.
+ */
+void alsactl_compact_elem_value_set_iec60958_channel_status(ALSACtlCompactElemValue *self,
+                                                            const guint8 *status, gsize length)
+{
+    struct snd_aes_iec958 *storage;
+
+    g_return_if_fail(self != NULL);
+    g_return_if_fail(self->elem_type == ALSACTL_ELEM_TYPE_IEC60958);
+    g_return_if_fail(status != NULL);
+
+    storage = (struct snd_aes_iec958 *)self->storage;
+    memset(storage->status, 0, sizeof(storage->status));
+    memcpy(storage->status, status, MIN(length, sizeof(storage->status)));
+}
+
+/**
+ * alsactl_compact_elem_value_get_iec60958_channel_status:
+ * @self: A [struct@CompactElemValue].
+ * @status: (array fixed-size=24)(out)(transfer none): The array of byte data for channel status
+ *          bits of IEC 60958.
+ *
+ * Refer to the storage for channel status bits of [enum@ElemType].IEC60958 element.
+ *
+ * Since: 0.4.
+ */
+void alsactl_compact_elem_value_get_iec60958_channel_status(const ALSACtlCompactElemValue *self,
+                                                            const guint8 **status)
+{
+    const struct snd_aes_iec958 *storage;
+
+    g_return_if_fail(self != NULL);
+    g_return_if_fail(self->elem_type == ALSACTL_ELEM_TYPE_IEC60958);
+    g_return_if_fail(status != NULL);
+
+    storage = (const struct snd_aes_iec958 *)self->storage;
+    *status = storage->status;
+}
+
+/**
+ * alsactl_compact_elem_value_set_iec60958_user_data:
+ * @self: A [struct@CompactElemValue].
+ * @data: (array length=length): The array of byte data for user data bits of IEC 60958.
+ * @length: The number of bytes in data argument, up to 147.
+ *
+ * Copy the user data bits into the storage for [enum@ElemType].IEC60958 element.
+ *
+ * Since: 0.4.
+ */
+void alsactl_compact_elem_value_set_iec60958_user_data(ALSACtlCompactElemValue *self,
+                                                       const guint8 *data, gsize length)
+{
+    struct snd_aes_iec958 *storage;
+
+    g_return_if_fail(self != NULL);
+    g_return_if_fail(self->elem_type == ALSACTL_ELEM_TYPE_IEC60958);
+    g_return_if_fail(data != NULL);
+
+    storage = (struct snd_aes_iec958 *)self->storage;
+    memset(storage->subcode, 0, sizeof(storage->subcode));
+    memcpy(storage->subcode, data, MIN(length, sizeof(storage->subcode)));
+}
+
+/**
+ * alsactl_compact_elem_value_get_iec60958_user_data:
+ * @self: A [struct@CompactElemValue].
+ * @data: (array fixed-size=147)(out)(transfer none): The array of byte data for user data bits of
+ *        IEC 60958.
+ *
+ * Refer to the storage for user data bits of [enum@ElemType].IEC60958 element.
+ *
+ * Since: 0.4.
+ */
+void alsactl_compact_elem_value_get_iec60958_user_data(const ALSACtlCompactElemValue *self,
+                                                       const guint8 **data)
+{
+    const struct snd_aes_iec958 *storage;
+
+    g_return_if_fail(self != NULL);
+    g_return_if_fail(self->elem_type == ALSACTL_ELEM_TYPE_IEC60958);
+    g_return_if_fail(data != NULL);
+
+    storage = (const struct snd_aes_iec958 *)self->storage;
+    *data = storage->subcode;
+}
+
+void ctl_compact_elem_value_refer_private(ALSACtlCompactElemValue *self, void **storage,
+                                          gsize *size)
+{
+    *storage = self->storage;
+    *size = self->size;
+}
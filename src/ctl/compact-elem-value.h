@@ -0,0 +1,60 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+#ifndef __ALSA_GOBJECT_ALSACTL_COMPACT_ELEM_VALUE_H__
+#define __ALSA_GOBJECT_ALSACTL_COMPACT_ELEM_VALUE_H__
+
+#include <alsactl.h>
+
+G_BEGIN_DECLS
+
+#define ALSACTL_TYPE_COMPACT_ELEM_VALUE     (alsactl_compact_elem_value_get_type())
+
+typedef struct _ALSACtlCompactElemValue ALSACtlCompactElemValue;
+
+GType alsactl_compact_elem_value_get_type() G_GNUC_CONST;
+
+ALSACtlCompactElemValue *alsactl_compact_elem_value_new(ALSACtlElemType elem_type,
+                                                        gsize value_count);
+
+void alsactl_compact_elem_value_get_elem_type(const ALSACtlCompactElemValue *self,
+                                              ALSACtlElemType *elem_type);
+void alsactl_compact_elem_value_get_value_count(const ALSACtlCompactElemValue *self,
+                                                gsize *value_count);
+
+void alsactl_compact_elem_value_set_bool(ALSACtlCompactElemValue *self, const gboolean *values,
+                                         gsize value_count);
+void alsactl_compact_elem_value_get_bool(const ALSACtlCompactElemValue *self,
+                                         gboolean *const *values, gsize *value_count);
+
+void alsactl_compact_elem_value_set_int(ALSACtlCompactElemValue *self, const gint32 *values,
+                                        gsize value_count);
+void alsactl_compact_elem_value_get_int(const ALSACtlCompactElemValue *self,
+                                        gint32 *const *values, gsize *value_count);
+
+void alsactl_compact_elem_value_set_enum(ALSACtlCompactElemValue *self, const guint32 *values,
+                                         gsize value_count);
+void alsactl_compact_elem_value_get_enum(const ALSACtlCompactElemValue *self,
+                                         const guint32 **values, gsize *value_count);
+
+void alsactl_compact_elem_value_set_bytes(ALSACtlCompactElemValue *self, const guint8 *values,
+                                          gsize value_count);
+void alsactl_compact_elem_value_get_bytes(const ALSACtlCompactElemValue *self,
+                                          const guint8 **values, gsize *value_count);
+
+void alsactl_compact_elem_value_set_int64(ALSACtlCompactElemValue *self, const gint64 *values,
+                                          gsize value_count);
+void alsactl_compact_elem_value_get_int64(const ALSACtlCompactElemValue *self,
+                                          const gint64 **values, gsize *value_count);
+
+void alsactl_compact_elem_value_set_iec60958_channel_status(ALSACtlCompactElemValue *self,
+                                                            const guint8 *status, gsize length);
+void alsactl_compact_elem_value_get_iec60958_channel_status(const ALSACtlCompactElemValue *self,
+                                                            const guint8 **status);
+
+void alsactl_compact_elem_value_set_iec60958_user_data(ALSACtlCompactElemValue *self,
+                                                       const guint8 *data, gsize length);
+void alsactl_compact_elem_value_get_iec60958_user_data(const ALSACtlCompactElemValue *self,
+                                                       const guint8 **data);
+
+G_END_DECLS
+
+#endif
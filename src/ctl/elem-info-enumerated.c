@@ -12,6 +12,7 @@
 typedef struct {
     struct snd_ctl_elem_info data;
     gchar **labels;
+    struct ctl_elem_enum_labels *shared_labels;
 } ALSACtlElemInfoEnumeratedPrivate;
 
 static void elem_info_common_iface_init(ALSACtlElemInfoCommonInterface *iface);
@@ -34,7 +35,10 @@ static void ctl_elem_info_enumerated_finalize(GObject *obj)
     ALSACtlElemInfoEnumerated *self = ALSACTL_ELEM_INFO_ENUMERATED(obj);
     ALSACtlElemInfoEnumeratedPrivate *priv = alsactl_elem_info_enumerated_get_instance_private(self);
 
-    g_strfreev(priv->labels);
+    if (priv->shared_labels != NULL)
+        ctl_elem_enum_labels_unref(priv->shared_labels);
+    else
+        g_strfreev(priv->labels);
 
     G_OBJECT_CLASS(alsactl_elem_info_enumerated_parent_class)->finalize(obj);
 }
@@ -47,8 +51,12 @@ static void ctl_elem_info_enumerated_set_property(GObject *obj, guint id, const
 
     switch (id) {
     case ELEM_INFO_ENUMERATED_PROP_LABELS:
-        if (priv->labels != NULL)
+        if (priv->shared_labels != NULL) {
+            ctl_elem_enum_labels_unref(priv->shared_labels);
+            priv->shared_labels = NULL;
+        } else if (priv->labels != NULL) {
             g_strfreev(priv->labels);
+        }
         priv->labels = g_strdupv(g_value_get_boxed(val));
         break;
     default:
@@ -135,3 +143,43 @@ void ctl_elem_info_enumerated_refer_private(ALSACtlElemInfoEnumerated *self,
 
     *data = &priv->data;
 }
+
+struct ctl_elem_enum_labels *ctl_elem_enum_labels_new(gchar **labels)
+{
+    struct ctl_elem_enum_labels *self = g_malloc0(sizeof(*self));
+
+    self->ref_count = 1;
+    self->labels = labels;
+
+    return self;
+}
+
+struct ctl_elem_enum_labels *ctl_elem_enum_labels_ref(struct ctl_elem_enum_labels *self)
+{
+    g_atomic_int_inc(&self->ref_count);
+    return self;
+}
+
+void ctl_elem_enum_labels_unref(struct ctl_elem_enum_labels *self)
+{
+    if (g_atomic_int_dec_and_test(&self->ref_count)) {
+        g_strfreev(self->labels);
+        g_free(self);
+    }
+}
+
+// NOTE: The labels are referred to, not duplicated, so that the instances of object for elements
+// with identical set of labels share the same vector.
+void ctl_elem_info_enumerated_share_labels(ALSACtlElemInfoEnumerated *self,
+                                           struct ctl_elem_enum_labels *labels)
+{
+    ALSACtlElemInfoEnumeratedPrivate *priv = alsactl_elem_info_enumerated_get_instance_private(self);
+
+    if (priv->shared_labels != NULL)
+        ctl_elem_enum_labels_unref(priv->shared_labels);
+    else if (priv->labels != NULL)
+        g_strfreev(priv->labels);
+
+    priv->shared_labels = ctl_elem_enum_labels_ref(labels);
+    priv->labels = labels->labels;
+}
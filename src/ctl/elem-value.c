@@ -1,6 +1,16 @@
 // SPDX-License-Identifier: LGPL-3.0-or-later
 #include "privates.h"
 
+#if G_MAXLONG == G_MAXINT64 && (defined(__x86_64__) || defined(__aarch64__))
+#define VECTOR_CONVERSION
+#endif
+
+#if defined(VECTOR_CONVERSION) && defined(__x86_64__)
+#include <immintrin.h>
+#elif defined(VECTOR_CONVERSION) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
 /**
  * ALSACtlElemValue:
  * A GObject-derived object to express the container of array for values specific to element type.
@@ -14,8 +24,16 @@
  */
 typedef struct {
     struct snd_ctl_elem_value value;
+    // The number of values in the element, or the size of array when it is unknown.
+    gsize value_count;
     gboolean boolean[128];
     gint32 integer[128];
+    // Whether the arrays are converted from the current storage.
+    gboolean boolean_converted;
+    gboolean integer_converted;
+    // The number of entries in the arrays which can be non-zero.
+    gsize boolean_count;
+    gsize integer_count;
 } ALSACtlElemValuePrivate;
 G_DEFINE_TYPE_WITH_PRIVATE(ALSACtlElemValue, alsactl_elem_value, G_TYPE_OBJECT)
 
@@ -44,12 +62,242 @@ static void ctl_elem_value_get_property(GObject *obj, guint id, GValue *val,
     }
 }
 
+// NOTE: The storage for boolean and integer type is the array of long type, while the arrays for
+// conversion are of 32 bit type. The conversion is done by vector instructions when long type is
+// 64 bit; SSE2 and NEON at compile time, AVX2 at runtime. The rest of values which do not fill
+// the vector register are converted by the scalar loop.
+
+static void widen_to_long_scalar(long *restrict dst, const gint32 *restrict src, gsize count)
+{
+    gsize i;
+
+    for (i = 0; i < count; ++i)
+        dst[i] = (long)src[i];
+}
+
+static void narrow_to_int32_scalar(gint32 *restrict dst, const long *restrict src, gsize count)
+{
+    gsize i;
+
+    for (i = 0; i < count; ++i)
+        dst[i] = (gint32)src[i];
+}
+
+static void narrow_to_boolean_scalar(gboolean *restrict dst, const long *restrict src,
+                                     gsize count)
+{
+    gsize i;
+
+    for (i = 0; i < count; ++i)
+        dst[i] = src[i] > 0;
+}
+
+#if defined(VECTOR_CONVERSION) && defined(__x86_64__)
+
+// SSE2 is always available in x86-64 architecture.
+static void widen_to_long_sse2(long *restrict dst, const gint32 *restrict src, gsize count)
+{
+    gsize i;
+
+    for (i = 0; i + 4 <= count; i += 4) {
+        __m128i val = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i sign = _mm_srai_epi32(val, 31);
+
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_unpacklo_epi32(val, sign));
+        _mm_storeu_si128((__m128i *)(dst + i + 2), _mm_unpackhi_epi32(val, sign));
+    }
+
+    widen_to_long_scalar(dst + i, src + i, count - i);
+}
+
+// Gather the lower or upper halves of four 64 bit values in two registers.
+static inline __m128i gather_lower_halves_sse2(__m128i lo, __m128i hi)
+{
+    __m128 merged = _mm_shuffle_ps(_mm_castsi128_ps(lo), _mm_castsi128_ps(hi),
+                                   _MM_SHUFFLE(2, 0, 2, 0));
+    return _mm_castps_si128(merged);
+}
+
+static inline __m128i gather_upper_halves_sse2(__m128i lo, __m128i hi)
+{
+    __m128 merged = _mm_shuffle_ps(_mm_castsi128_ps(lo), _mm_castsi128_ps(hi),
+                                   _MM_SHUFFLE(3, 1, 3, 1));
+    return _mm_castps_si128(merged);
+}
+
+static void narrow_to_int32_sse2(gint32 *restrict dst, const long *restrict src, gsize count)
+{
+    gsize i;
+
+    for (i = 0; i + 4 <= count; i += 4) {
+        __m128i lo = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i hi = _mm_loadu_si128((const __m128i *)(src + i + 2));
+
+        _mm_storeu_si128((__m128i *)(dst + i), gather_lower_halves_sse2(lo, hi));
+    }
+
+    narrow_to_int32_scalar(dst + i, src + i, count - i);
+}
+
+static void narrow_to_boolean_sse2(gboolean *restrict dst, const long *restrict src, gsize count)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i one = _mm_set1_epi32(1);
+    gsize i;
+
+    // NOTE: SSE2 has no comparison of 64 bit values. The value is positive when the upper half is
+    // positive, or when the upper half is zero and the lower half is not zero.
+    for (i = 0; i + 4 <= count; i += 4) {
+        __m128i lo = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i hi = _mm_loadu_si128((const __m128i *)(src + i + 2));
+        __m128i lower = gather_lower_halves_sse2(lo, hi);
+        __m128i upper = gather_upper_halves_sse2(lo, hi);
+        __m128i upper_zero = _mm_cmpeq_epi32(upper, zero);
+        __m128i positive = _mm_or_si128(_mm_cmpgt_epi32(upper, zero),
+                                        _mm_andnot_si128(_mm_cmpeq_epi32(lower, zero),
+                                                         upper_zero));
+
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_and_si128(positive, one));
+    }
+
+    narrow_to_boolean_scalar(dst + i, src + i, count - i);
+}
+
+__attribute__((target("avx2")))
+static void widen_to_long_avx2(long *restrict dst, const gint32 *restrict src, gsize count)
+{
+    gsize i;
+
+    for (i = 0; i + 4 <= count; i += 4) {
+        __m128i val = _mm_loadu_si128((const __m128i *)(src + i));
+
+        _mm256_storeu_si256((__m256i *)(dst + i), _mm256_cvtepi32_epi64(val));
+    }
+
+    widen_to_long_scalar(dst + i, src + i, count - i);
+}
+
+__attribute__((target("avx2")))
+static void narrow_to_int32_avx2(gint32 *restrict dst, const long *restrict src, gsize count)
+{
+    const __m256i lower = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+    gsize i;
+
+    for (i = 0; i + 4 <= count; i += 4) {
+        __m256i val = _mm256_loadu_si256((const __m256i *)(src + i));
+
+        val = _mm256_permutevar8x32_epi32(val, lower);
+        _mm_storeu_si128((__m128i *)(dst + i), _mm256_castsi256_si128(val));
+    }
+
+    narrow_to_int32_scalar(dst + i, src + i, count - i);
+}
+
+__attribute__((target("avx2")))
+static void narrow_to_boolean_avx2(gboolean *restrict dst, const long *restrict src, gsize count)
+{
+    const __m256i lower = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+    const __m256i zero = _mm256_setzero_si256();
+    const __m128i one = _mm_set1_epi32(1);
+    gsize i;
+
+    for (i = 0; i + 4 <= count; i += 4) {
+        __m256i val = _mm256_loadu_si256((const __m256i *)(src + i));
+        __m256i positive = _mm256_cmpgt_epi64(val, zero);
+
+        positive = _mm256_permutevar8x32_epi32(positive, lower);
+        _mm_storeu_si128((__m128i *)(dst + i),
+                         _mm_and_si128(_mm256_castsi256_si128(positive), one));
+    }
+
+    narrow_to_boolean_scalar(dst + i, src + i, count - i);
+}
+
+#elif defined(VECTOR_CONVERSION) && defined(__aarch64__)
+
+// NEON is always available in AArch64 architecture.
+static void widen_to_long_neon(long *restrict dst, const gint32 *restrict src, gsize count)
+{
+    gsize i;
+
+    for (i = 0; i + 4 <= count; i += 4) {
+        int32x4_t val = vld1q_s32(src + i);
+
+        vst1q_s64((int64_t *)(dst + i), vmovl_s32(vget_low_s32(val)));
+        vst1q_s64((int64_t *)(dst + i + 2), vmovl_high_s32(val));
+    }
+
+    widen_to_long_scalar(dst + i, src + i, count - i);
+}
+
+static void narrow_to_int32_neon(gint32 *restrict dst, const long *restrict src, gsize count)
+{
+    gsize i;
+
+    for (i = 0; i + 4 <= count; i += 4) {
+        int64x2_t lo = vld1q_s64((const int64_t *)(src + i));
+        int64x2_t hi = vld1q_s64((const int64_t *)(src + i + 2));
+
+        vst1q_s32(dst + i, vcombine_s32(vmovn_s64(lo), vmovn_s64(hi)));
+    }
+
+    narrow_to_int32_scalar(dst + i, src + i, count - i);
+}
+
+static void narrow_to_boolean_neon(gboolean *restrict dst, const long *restrict src, gsize count)
+{
+    const uint32x4_t one = vdupq_n_u32(1);
+    gsize i;
+
+    for (i = 0; i + 4 <= count; i += 4) {
+        uint64x2_t lo = vcgtzq_s64(vld1q_s64((const int64_t *)(src + i)));
+        uint64x2_t hi = vcgtzq_s64(vld1q_s64((const int64_t *)(src + i + 2)));
+        uint32x4_t positive = vcombine_u32(vmovn_u64(lo), vmovn_u64(hi));
+
+        vst1q_s32(dst + i, vreinterpretq_s32_u32(vandq_u32(positive, one)));
+    }
+
+    narrow_to_boolean_scalar(dst + i, src + i, count - i);
+}
+
+#endif
+
+static void (*widen_to_long)(long *restrict dst, const gint32 *restrict src, gsize count);
+static void (*narrow_to_int32)(gint32 *restrict dst, const long *restrict src, gsize count);
+static void (*narrow_to_boolean)(gboolean *restrict dst, const long *restrict src, gsize count);
+
+static void select_conversion_kernels(void)
+{
+#if defined(VECTOR_CONVERSION) && defined(__x86_64__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        widen_to_long = widen_to_long_avx2;
+        narrow_to_int32 = narrow_to_int32_avx2;
+        narrow_to_boolean = narrow_to_boolean_avx2;
+    } else {
+        widen_to_long = widen_to_long_sse2;
+        narrow_to_int32 = narrow_to_int32_sse2;
+        narrow_to_boolean = narrow_to_boolean_sse2;
+    }
+#elif defined(VECTOR_CONVERSION) && defined(__aarch64__)
+    widen_to_long = widen_to_long_neon;
+    narrow_to_int32 = narrow_to_int32_neon;
+    narrow_to_boolean = narrow_to_boolean_neon;
+#else
+    widen_to_long = widen_to_long_scalar;
+    narrow_to_int32 = narrow_to_int32_scalar;
+    narrow_to_boolean = narrow_to_boolean_scalar;
+#endif
+}
+
 static void alsactl_elem_value_class_init(ALSACtlElemValueClass *klass)
 {
     GObjectClass *gobject_class = G_OBJECT_CLASS(klass);
 
     gobject_class->get_property = ctl_elem_value_get_property;
 
+    select_conversion_kernels();
+
     /**
      * ALSACtlElemValue:elem-id:
      *
@@ -67,7 +315,10 @@ static void alsactl_elem_value_class_init(ALSACtlElemValueClass *klass)
 
 static void alsactl_elem_value_init(ALSACtlElemValue *self)
 {
-    return;
+    ALSACtlElemValuePrivate *priv =
+                                alsactl_elem_value_get_instance_private(self);
+
+    priv->value_count = G_N_ELEMENTS(priv->value.value.integer.value);
 }
 
 /**
@@ -82,13 +333,59 @@ ALSACtlElemValue *alsactl_elem_value_new()
     return g_object_new(ALSACTL_TYPE_ELEM_VALUE, NULL);
 }
 
+// NOTE: The number of values is unknown till the caller tells it.
+static inline void invalidate_converted_arrays(ALSACtlElemValuePrivate *priv)
+{
+    priv->value_count = G_N_ELEMENTS(priv->value.value.integer.value);
+    priv->boolean_converted = FALSE;
+    priv->integer_converted = FALSE;
+}
+
+// NOTE: The arrays for conversion are invalidated since the storage can be changed by the caller.
 void ctl_elem_value_refer_private(ALSACtlElemValue *self, struct snd_ctl_elem_value **value)
 {
     ALSACtlElemValuePrivate *priv =
                                 alsactl_elem_value_get_instance_private(self);
+    invalidate_converted_arrays(priv);
     *value = &priv->value;
 }
 
+void ctl_elem_value_set_value_count(ALSACtlElemValue *self, gsize value_count)
+{
+    ALSACtlElemValuePrivate *priv =
+                                alsactl_elem_value_get_instance_private(self);
+    priv->value_count = MIN(value_count, G_N_ELEMENTS(priv->value.value.integer.value));
+}
+
+// Clear the entries converted previously beyond the number of values, then return the number of
+// values to be converted.
+static gsize prepare_converted_array(ALSACtlElemValuePrivate *priv, void *array, gsize entry_size,
+                                     gsize *count)
+{
+    gsize value_count = priv->value_count;
+
+    if (*count > value_count)
+        memset((guint8 *)array + entry_size * value_count, 0, entry_size * (*count - value_count));
+    *count = value_count;
+
+    return value_count;
+}
+
+// Fill the rest of storage with zero, then return the number of values to be converted.
+static gsize prepare_integer_storage(ALSACtlElemValuePrivate *priv, gsize value_count)
+{
+    struct snd_ctl_elem_value *value = &priv->value;
+
+    value_count = MIN(value_count, G_N_ELEMENTS(value->value.integer.value));
+    memset(value->value.integer.value + value_count, 0,
+           sizeof(*value->value.integer.value) *
+           (G_N_ELEMENTS(value->value.integer.value) - value_count));
+
+    invalidate_converted_arrays(priv);
+
+    return value_count;
+}
+
 /**
  * alsactl_elem_value_set_bool:
  * @self: A [class@ElemValue].
@@ -101,7 +398,6 @@ void alsactl_elem_value_set_bool(ALSACtlElemValue *self, const gboolean *values,
 {
     ALSACtlElemValuePrivate *priv;
     struct snd_ctl_elem_value *value;
-    int i;
 
     g_return_if_fail(ALSACTL_IS_ELEM_VALUE(self));
     priv = alsactl_elem_value_get_instance_private(self);
@@ -109,10 +405,9 @@ void alsactl_elem_value_set_bool(ALSACtlElemValue *self, const gboolean *values,
     g_return_if_fail(values != NULL);
 
     value = &priv->value;
-    memset(&value->value.integer.value, 0, sizeof(value->value.integer.value));
-    value_count = MIN(value_count, G_N_ELEMENTS(value->value.integer.value));
-    for (i = 0; i < value_count; ++i)
-        value->value.integer.value[i] = (long)values[i];
+    value_count = prepare_integer_storage(priv, value_count);
+    widen_to_long(value->value.integer.value, (const gint32 *)values, value_count);
+    priv->value_count = value_count;
 }
 
 /**
@@ -120,22 +415,29 @@ void alsactl_elem_value_set_bool(ALSACtlElemValue *self, const gboolean *values,
  * @self: A [class@ElemValue].
  * @values: (array fixed-size=128) (out) (transfer none): The array for boolean values.
  * 
- * Refer to the array specific to [enum@ElemType].BOOLEAN element in internal storage.
+ * Refer to the array specific to [enum@ElemType].BOOLEAN element in internal storage. When the
+ * number of values in the element is known, just the values are converted and the rest of entries
+ * are zero.
  */
 void alsactl_elem_value_get_bool(ALSACtlElemValue *self, const gboolean **values)
 {
     ALSACtlElemValuePrivate *priv;
     struct snd_ctl_elem_value *value;
-    int i;
 
     g_return_if_fail(ALSACTL_IS_ELEM_VALUE(self));
     priv = alsactl_elem_value_get_instance_private(self);
 
     g_return_if_fail(values != NULL);
 
+    // NOTE: Convert just when the storage is changed since the last conversion, and just for the
+    // number of values in the element.
     value = &priv->value;
-    for (i = 0; i < G_N_ELEMENTS(value->value.integer.value); ++i)
-        priv->boolean[i] = value->value.integer.value[i] > 0;
+    if (!priv->boolean_converted) {
+        gsize count = prepare_converted_array(priv, priv->boolean, sizeof(*priv->boolean),
+                                              &priv->boolean_count);
+        narrow_to_boolean(priv->boolean, value->value.integer.value, count);
+        priv->boolean_converted = TRUE;
+    }
 
     *values = priv->boolean;
 }
@@ -152,7 +454,6 @@ void alsactl_elem_value_set_int(ALSACtlElemValue *self, const gint32 *values, gs
 {
     ALSACtlElemValuePrivate *priv;
     struct snd_ctl_elem_value *value;
-    int i;
 
     g_return_if_fail(ALSACTL_IS_ELEM_VALUE(self));
     priv = alsactl_elem_value_get_instance_private(self);
@@ -160,10 +461,9 @@ void alsactl_elem_value_set_int(ALSACtlElemValue *self, const gint32 *values, gs
     g_return_if_fail(values != NULL);
 
     value = &priv->value;
-    memset(&value->value.integer.value, 0, sizeof(value->value.integer.value));
-    value_count = MIN(value_count, G_N_ELEMENTS(value->value.integer.value));
-    for (i = 0; i < value_count; ++i)
-        value->value.integer.value[i] = (long)values[i];
+    value_count = prepare_integer_storage(priv, value_count);
+    widen_to_long(value->value.integer.value, values, value_count);
+    priv->value_count = value_count;
 }
 
 /**
@@ -172,22 +472,28 @@ void alsactl_elem_value_set_int(ALSACtlElemValue *self, const gint32 *values, gs
  * @values: (array fixed-size=128) (out) (transfer none): The array for 32 bit signed integer
  *          values.
  *
- * Refer to the array for [enum@ElemType].INTEGER element in internal storage.
+ * Refer to the array for [enum@ElemType].INTEGER element in internal storage. When the number of
+ * values in the element is known, just the values are converted and the rest of entries are zero.
  */
 void alsactl_elem_value_get_int(ALSACtlElemValue *self, const gint32 **values)
 {
     ALSACtlElemValuePrivate *priv;
     struct snd_ctl_elem_value *value;
-    int i;
 
     g_return_if_fail(ALSACTL_IS_ELEM_VALUE(self));
     priv = alsactl_elem_value_get_instance_private(self);
 
     g_return_if_fail(values != NULL);
 
+    // NOTE: Convert just when the storage is changed since the last conversion, and just for the
+    // number of values in the element.
     value = &priv->value;
-    for (i = 0; i < G_N_ELEMENTS(value->value.integer.value); ++i)
-            priv->integer[i] = (gint32)value->value.integer.value[i];
+    if (!priv->integer_converted) {
+        gsize count = prepare_converted_array(priv, priv->integer, sizeof(*priv->integer),
+                                              &priv->integer_count);
+        narrow_to_int32(priv->integer, value->value.integer.value, count);
+        priv->integer_converted = TRUE;
+    }
 
     *values = priv->integer;
 }
@@ -212,6 +518,7 @@ void alsactl_elem_value_set_enum(ALSACtlElemValue *self, const guint32 *values,
     g_return_if_fail(values != NULL);
 
     value = &priv->value;
+    invalidate_converted_arrays(priv);
     memset(&value->value.enumerated.item, 0, sizeof(value->value.enumerated.item));
     value_count = MIN(value_count, G_N_ELEMENTS(value->value.enumerated.item));
     for (i = 0; i < value_count; ++i)
@@ -260,6 +567,7 @@ void alsactl_elem_value_set_bytes(ALSACtlElemValue *self, const guint8 *values,
     g_return_if_fail(values != NULL);
 
     value = &priv->value;
+    invalidate_converted_arrays(priv);
     memset(&value->value.bytes.data, 0, sizeof(value->value.bytes.data));
     value_count = MIN(value_count, G_N_ELEMENTS(value->value.bytes.data));
     for (i = 0; i < value_count; ++i)
@@ -309,6 +617,7 @@ void alsactl_elem_value_set_iec60958_channel_status(ALSACtlElemValue *self, cons
     g_return_if_fail(status != NULL);
 
     value = &priv->value;
+    invalidate_converted_arrays(priv);
     memset(&value->value.iec958.status, 0, sizeof(value->value.iec958.status));
     length = MIN(length, G_N_ELEMENTS(value->value.iec958.status));
     for (i = 0; i < length; ++i)
@@ -358,6 +667,7 @@ void alsactl_elem_value_set_iec60958_user_data(ALSACtlElemValue *self, const gui
     g_return_if_fail(data != NULL);
 
     value = &priv->value;
+    invalidate_converted_arrays(priv);
     memset(&value->value.iec958.subcode, 0, sizeof(value->value.iec958.subcode));
     length = MIN(length, G_N_ELEMENTS(value->value.iec958.subcode));
     for (i = 0; i < length; ++i)
@@ -406,6 +716,7 @@ void alsactl_elem_value_set_int64(ALSACtlElemValue *self, const gint64 *values,
     g_return_if_fail(values != NULL);
 
     value = &priv->value;
+    invalidate_converted_arrays(priv);
     memset(&value->value.integer64.value, 0, sizeof(value->value.integer64.value));
     value_count = MIN(value_count, G_N_ELEMENTS(value->value.integer64.value));
     for (i = 0; i < value_count; ++i)
@@ -17,6 +17,20 @@ void ctl_elem_info_bytes_refer_private(ALSACtlElemInfoBytes *self, struct snd_ct
 void ctl_elem_info_enumerated_refer_private(ALSACtlElemInfoEnumerated *self,
                                             struct snd_ctl_elem_info **data);
 
+struct ctl_elem_enum_labels {
+    gint ref_count;
+    gchar **labels;
+};
+
+struct ctl_elem_enum_labels *ctl_elem_enum_labels_new(gchar **labels);
+
+struct ctl_elem_enum_labels *ctl_elem_enum_labels_ref(struct ctl_elem_enum_labels *self);
+
+void ctl_elem_enum_labels_unref(struct ctl_elem_enum_labels *self);
+
+void ctl_elem_info_enumerated_share_labels(ALSACtlElemInfoEnumerated *self,
+                                           struct ctl_elem_enum_labels *labels);
+
 void ctl_elem_info_iec60958_refer_private(ALSACtlElemInfoIec60958 *self,
                                           struct snd_ctl_elem_info **data);
 
@@ -28,6 +42,10 @@ void ctl_elem_info_integer64_refer_private(ALSACtlElemInfoInteger64 *self,
 
 void ctl_elem_value_refer_private(ALSACtlElemValue *self,
                                   struct snd_ctl_elem_value **value);
+void ctl_elem_value_set_value_count(ALSACtlElemValue *self, gsize value_count);
+
+void ctl_compact_elem_value_refer_private(ALSACtlCompactElemValue *self, void **storage,
+                                          gsize *size);
 
 #define ELEM_ID_PROP_NAME       "elem-id"
 #define ELEM_TYPE_PROP_NAME     "elem-type"
@@ -365,6 +365,22 @@ typedef enum /*< flags >*/
     ALSASEQ_REMOVE_FILTER_FLAG_TAG_MATCH    = SNDRV_SEQ_REMOVE_TAG_MATCH,
 } ALSASeqRemoveFilterFlag;
 
+/**
+ * ALSASeqGraphChangeType:
+ * @ALSASEQ_GRAPH_CHANGE_TYPE_ADDED:    The entry is added to the graph.
+ * @ALSASEQ_GRAPH_CHANGE_TYPE_REMOVED:  The entry is removed from the graph.
+ * @ALSASEQ_GRAPH_CHANGE_TYPE_UPDATED:  The information of entry is updated in the graph.
+ *
+ * A set of enumerations for the type of change in [class@LiveGraph].
+ *
+ * Since: 0.4.
+ */
+typedef enum {
+    ALSASEQ_GRAPH_CHANGE_TYPE_ADDED = 0,
+    ALSASEQ_GRAPH_CHANGE_TYPE_REMOVED,
+    ALSASEQ_GRAPH_CHANGE_TYPE_UPDATED,
+} ALSASeqGraphChangeType;
+
 /**
  * ALSASeqUserClientError:
  * @ALSASEQ_USER_CLIENT_ERROR_FAILED:               The system call failed.
@@ -17,7 +17,6 @@
 #include <event-data-connect.h>
 #include <event-data-result.h>
 #include <remove-filter.h>
-#include <event-cntr.h>
 
 #include <queue-timer-common.h>
 
@@ -26,14 +25,16 @@
 #include <client-pool.h>
 #include <port-info.h>
 #include <subscribe-data.h>
-#include <event-cntr.h>
 #include <event.h>
+#include <event-cntr.h>
 #include <queue-info.h>
 #include <queue-status.h>
 #include <queue-tempo.h>
 #include <queue-timer-alsa.h>
+#include <graph-snapshot.h>
 
 #include <user-client.h>
+#include <live-graph.h>
 
 #include <query.h>
 
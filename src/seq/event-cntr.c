@@ -7,6 +7,33 @@
  *
  * For batch of events, [struct@EventCntr] keeps flatten buffer which serialize the events without
  * pointing to extra data blob for variable type.
+ *
+ * The [struct@EventCntr] allocated by the call of [ctor@EventCntr.new] is available to build the
+ * batch of events for [method@UserClient.schedule_event_cntr]. The call of
+ * [method@EventCntr.append_event] appends the event to the buffer which grows geometrically. The
+ * call of [method@EventCntr.reset] discards the events, while the allocated buffer is kept for
+ * reuse.
+ *
+ * The events in the buffer are available by two ways. The call of [method@EventCntr.deserialize]
+ * returns the list of events duplicated from the buffer. The [struct@EventCntrIter] refers to the
+ * events in the buffer without any memory allocation.
+ *
+ * The [struct@EventCntr] passed to the handler installed by [method@UserClient.set_event_handler]
+ * borrows the buffer from the source, thus it is not available for
+ * [method@EventCntr.append_event], [method@EventCntr.reset], and [method@UserClient.pop_events].
+ * The copy of the container is available for them.
+ */
+
+/**
+ * ALSASeqEventCntrIter:
+ * A structure to iterate events in [struct@EventCntr].
+ *
+ * A [struct@EventCntrIter] is expected to be allocated in stack, then initialized by the call of
+ * [method@EventCntrIter.init]. The call of [method@EventCntrIter.next] returns the event in the
+ * flatten buffer of container one by one. The returned event is borrowed from the buffer, thus
+ * it is not available after the container is released.
+ *
+ * Since: 0.4.
  */
 
 static ALSASeqEventCntr *seq_event_cntr_copy(const ALSASeqEventCntr *src)
@@ -18,6 +45,8 @@ static ALSASeqEventCntr *seq_event_cntr_copy(const ALSASeqEventCntr *src)
 
     dst->buf = g_malloc0(src->length);
     memcpy(dst->buf, src->buf, src->length);
+    dst->capacity = src->length;
+    dst->owned = TRUE;
 
     return dst;
 }
@@ -30,15 +59,99 @@ static void seq_event_cntr_free(ALSASeqEventCntr *self)
 
 G_DEFINE_BOXED_TYPE(ALSASeqEventCntr, alsaseq_event_cntr, seq_event_cntr_copy, seq_event_cntr_free);
 
-struct seq_event_iter {
-    guint8 *buf;
+/**
+ * alsaseq_event_cntr_new:
+ * @capacity: The initial size of buffer in byte unit.
+ *
+ * Allocate and return an instance of [struct@EventCntr] without any event. The layout of buffer
+ * is available for [method@UserClient.schedule_event_cntr].
+ *
+ * Returns: An instance of [struct@EventCntr].
+ *
+ * Since: 0.4.
+ */
+ALSASeqEventCntr *alsaseq_event_cntr_new(gsize capacity)
+{
+    ALSASeqEventCntr *self;
+
+    self = g_malloc0(sizeof(*self));
+    if (capacity > 0)
+        self->buf = g_malloc0(capacity);
+    self->capacity = capacity;
+    self->aligned = FALSE;
+    self->owned = TRUE;
+
+    return self;
+}
+
+void seq_event_cntr_reserve(ALSASeqEventCntr *self, gsize length)
+{
+    gsize capacity;
+
+    if (length <= self->capacity)
+        return;
+
+    // Grow geometrically so that the cost of reallocation is amortized.
+    capacity = MAX(self->capacity * 2, sizeof(struct snd_seq_event) * 16);
+    while (capacity < length)
+        capacity *= 2;
+
+    self->buf = g_realloc(self->buf, capacity);
+    self->capacity = capacity;
+}
+
+/**
+ * alsaseq_event_cntr_append_event:
+ * @self: A [struct@EventCntr].
+ * @event: A [struct@Event] to append.
+ *
+ * Append the event to the flatten buffer. For [enum@EventLengthMode].VARIABLE type of event, the
+ * blob data is copied to the buffer as well. The buffer is reallocated when the capacity is not
+ * enough. The container borrowing the buffer from the source of [class@UserClient] is not
+ * available.
+ *
+ * Since: 0.4.
+ */
+void alsaseq_event_cntr_append_event(ALSASeqEventCntr *self, const ALSASeqEvent *event)
+{
     gsize length;
-    gsize offset;
-    gboolean aligned;
-};
+    gsize padding;
+
+    g_return_if_fail(self != NULL);
+    g_return_if_fail(self->owned);
+    g_return_if_fail(event != NULL);
+
+    length = seq_event_calculate_flattened_length(event, self->aligned);
+    seq_event_cntr_reserve(self, self->length + length);
+
+    seq_event_copy_flattened(event, self->buf + self->length, length);
 
-static void seq_event_iter_init(struct seq_event_iter *iter, guint8 *buf, gsize length,
-                                gboolean aligned)
+    padding = length - seq_event_calculate_flattened_length(event, FALSE);
+    if (padding > 0)
+        memset(self->buf + self->length + length - padding, 0, padding);
+
+    self->length += length;
+}
+
+/**
+ * alsaseq_event_cntr_reset:
+ * @self: A [struct@EventCntr].
+ *
+ * Discard all of events in the flatten buffer. The buffer is not released so that it is reused
+ * for the events appended later. The container borrowing the buffer from the source of
+ * [class@UserClient] is not available.
+ *
+ * Since: 0.4.
+ */
+void alsaseq_event_cntr_reset(ALSASeqEventCntr *self)
+{
+    g_return_if_fail(self != NULL);
+    g_return_if_fail(self->owned);
+
+    self->length = 0;
+}
+
+void seq_event_iter_init(ALSASeqEventCntrIter *iter, guint8 *buf, gsize length, gboolean aligned)
 {
     iter->buf = buf;
     iter->length = length;
@@ -46,14 +159,14 @@ static void seq_event_iter_init(struct seq_event_iter *iter, guint8 *buf, gsize
     iter->aligned = aligned;
 }
 
-static struct snd_seq_event *seq_event_iter_next(struct seq_event_iter *iter)
+struct snd_seq_event *seq_event_iter_next(ALSASeqEventCntrIter *iter)
 {
     gsize length;
 
     if (iter->buf == NULL)
         return NULL;
 
-    if (iter->offset < iter->length) {
+    if (iter->offset + sizeof(struct snd_seq_event) <= iter->length) {
         struct snd_seq_event *ev = (struct snd_seq_event *)(iter->buf + iter->offset);
         length = seq_event_calculate_flattened_length(ev, iter->aligned);
 
@@ -111,6 +224,8 @@ void seq_event_cntr_serialize(ALSASeqEventCntr *self, const GList *events, gbool
     self->buf = buf;
     self->length = total_length;
     self->aligned = aligned;
+    self->capacity = total_length;
+    self->owned = TRUE;
 }
 
 /**
@@ -122,8 +237,9 @@ void seq_event_cntr_serialize(ALSASeqEventCntr *self, const GList *events, gbool
  */
 void alsaseq_event_cntr_deserialize(const ALSASeqEventCntr *self, GList **events)
 {
-    struct seq_event_iter iter;
+    ALSASeqEventCntrIter iter;
     struct snd_seq_event *ev;
+    GList *head = NULL;
 
     seq_event_iter_init(&iter, self->buf, self->length, self->aligned);
     while ((ev = seq_event_iter_next(&iter))) {
@@ -132,6 +248,63 @@ void alsaseq_event_cntr_deserialize(const ALSASeqEventCntr *self, GList **events
         // MEMO: For [enum@EventLengthMode].VARIABLE type of event, a memory object is allocated
         // for blob data, since the size of boxed structure should have fixed size.
         event = g_boxed_copy(ALSASEQ_TYPE_EVENT, ev);
-        *events = g_list_append(*events, event);
+        head = g_list_prepend(head, event);
     }
+
+    // NOTE: Prepend entries and reverse them at last to avoid traversing the list for each entry.
+    *events = g_list_concat(*events, g_list_reverse(head));
+}
+
+/**
+ * alsaseq_event_cntr_iter_init:
+ * @iter: A [struct@EventCntrIter] to initialize.
+ * @cntr: A [struct@EventCntr] to iterate.
+ *
+ * Initialize the iterator to refer to the first event in the container. The container should not
+ * be released while the iterator is used. The buffer of container is modified by the call of
+ * [method@EventCntrIter.next] for [enum@EventLengthMode].VARIABLE type of event.
+ *
+ * Since: 0.4.
+ */
+void alsaseq_event_cntr_iter_init(ALSASeqEventCntrIter *iter, ALSASeqEventCntr *cntr)
+{
+    g_return_if_fail(iter != NULL);
+    g_return_if_fail(cntr != NULL);
+
+    seq_event_iter_init(iter, cntr->buf, cntr->length, cntr->aligned);
+}
+
+/**
+ * alsaseq_event_cntr_iter_next:
+ * @iter: A [struct@EventCntrIter].
+ * @event: (out) (transfer none) (nullable): The event in the container, or %NULL when no event
+ *         remains.
+ *
+ * Advance the iterator and refer to the next event in flatten buffer of the container. No memory
+ * is allocated for the event, including blob data for [enum@EventLengthMode].VARIABLE type. For
+ * the type of event, the pointer to blob data is rewritten in the buffer so that it points to the
+ * blob data following the event.
+ *
+ * Returns: %TRUE when the event is available, else %FALSE.
+ *
+ * Since: 0.4.
+ */
+gboolean alsaseq_event_cntr_iter_next(ALSASeqEventCntrIter *iter, const ALSASeqEvent **event)
+{
+    struct snd_seq_event *ev;
+
+    g_return_val_if_fail(iter != NULL, FALSE);
+    g_return_val_if_fail(event != NULL, FALSE);
+
+    ev = seq_event_iter_next(iter);
+
+    // NOTE: In flattened layout, the blob data of variable type follows the event. The pointer is
+    // rewritten so that the event can be passed to accessors without copy.
+    if (ev != NULL &&
+        (ev->flags & SNDRV_SEQ_EVENT_LENGTH_MASK) == SNDRV_SEQ_EVENT_LENGTH_VARIABLE)
+        ev->data.ext.ptr = (guint8 *)ev + sizeof(*ev);
+
+    *event = ev;
+
+    return ev != NULL;
 }
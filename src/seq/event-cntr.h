@@ -13,12 +13,30 @@ typedef struct {
     guint8 *buf;
     gsize length;
     gboolean aligned;
+    gsize capacity;
+    gboolean owned;
 } ALSASeqEventCntr;
 
+typedef struct {
+    /*< private >*/
+    guint8 *buf;
+    gsize length;
+    gsize offset;
+    gboolean aligned;
+} ALSASeqEventCntrIter;
+
 GType alsaseq_event_cntr_get_type() G_GNUC_CONST;
 
+ALSASeqEventCntr *alsaseq_event_cntr_new(gsize capacity);
+
+void alsaseq_event_cntr_append_event(ALSASeqEventCntr *self, const ALSASeqEvent *event);
+void alsaseq_event_cntr_reset(ALSASeqEventCntr *self);
+
 void alsaseq_event_cntr_deserialize(const ALSASeqEventCntr *self, GList **events);
 
+void alsaseq_event_cntr_iter_init(ALSASeqEventCntrIter *iter, ALSASeqEventCntr *cntr);
+gboolean alsaseq_event_cntr_iter_next(ALSASeqEventCntrIter *iter, const ALSASeqEvent **event);
+
 G_END_DECLS
 
 #endif
@@ -0,0 +1,115 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+#include "privates.h"
+
+// A ring buffer to pass batch of events from single producer to single consumer without lock.
+// Each record consists of the length of batch in 4 bytes and the flatten layout of events. The
+// positions are increased monotonically and wrap around at the boundary of guint, thus the size
+// of buffer should be power of two.
+struct seq_event_ring {
+    guint8 *buf;
+    guint size;
+    guint head;
+    guint tail;
+    guint overrun_count;
+    guint high_watermark;
+};
+
+struct seq_event_ring *seq_event_ring_new(guint size)
+{
+    struct seq_event_ring *ring;
+
+    g_return_val_if_fail(size > sizeof(guint32) && size <= G_MAXINT, NULL);
+
+    // Round up to power of two.
+    if (size & (size - 1))
+        size = 1u << g_bit_storage(size);
+
+    ring = g_malloc0(sizeof(*ring));
+    ring->buf = g_malloc0(size);
+    ring->size = size;
+
+    return ring;
+}
+
+void seq_event_ring_free(struct seq_event_ring *ring)
+{
+    g_free(ring->buf);
+    g_free(ring);
+}
+
+static void ring_write(struct seq_event_ring *ring, guint pos, const guint8 *src, gsize length)
+{
+    guint offset = pos & (ring->size - 1);
+    gsize first = MIN(length, ring->size - offset);
+
+    memcpy(ring->buf + offset, src, first);
+    memcpy(ring->buf, src + first, length - first);
+}
+
+static void ring_read(const struct seq_event_ring *ring, guint pos, guint8 *dst, gsize length)
+{
+    guint offset = pos & (ring->size - 1);
+    gsize first = MIN(length, ring->size - offset);
+
+    memcpy(dst, ring->buf + offset, first);
+    memcpy(dst + first, ring->buf, length - first);
+}
+
+// Called by the producer only. The batch is dropped when the space is not enough.
+gboolean seq_event_ring_push(struct seq_event_ring *ring, const guint8 *buf, gsize length)
+{
+    guint head = (guint)g_atomic_int_get(&ring->head);
+    guint tail = (guint)g_atomic_int_get(&ring->tail);
+    guint32 record_length = (guint32)length;
+    guint used = head - tail;
+
+    if (sizeof(record_length) + length > ring->size - used) {
+        g_atomic_int_inc(&ring->overrun_count);
+        return FALSE;
+    }
+
+    ring_write(ring, head, (const guint8 *)&record_length, sizeof(record_length));
+    ring_write(ring, head + sizeof(record_length), buf, length);
+
+    used += sizeof(record_length) + length;
+    if (used > (guint)g_atomic_int_get(&ring->high_watermark))
+        g_atomic_int_set(&ring->high_watermark, used);
+
+    // The atomic operation is a full barrier, thus the record is visible to the consumer before
+    // the position.
+    g_atomic_int_set(&ring->head, head + sizeof(record_length) + length);
+
+    return TRUE;
+}
+
+// Called by the consumer only. The buffer of container is reused.
+gboolean seq_event_ring_pop(struct seq_event_ring *ring, ALSASeqEventCntr *cntr)
+{
+    guint tail = (guint)g_atomic_int_get(&ring->tail);
+    guint head = (guint)g_atomic_int_get(&ring->head);
+    guint32 record_length;
+
+    if (head == tail)
+        return FALSE;
+
+    ring_read(ring, tail, (guint8 *)&record_length, sizeof(record_length));
+
+    seq_event_cntr_reserve(cntr, record_length);
+    ring_read(ring, tail + sizeof(record_length), cntr->buf, record_length);
+    cntr->length = record_length;
+    cntr->aligned = TRUE;
+
+    g_atomic_int_set(&ring->tail, tail + sizeof(record_length) + record_length);
+
+    return TRUE;
+}
+
+guint seq_event_ring_get_overrun_count(struct seq_event_ring *ring)
+{
+    return (guint)g_atomic_int_get(&ring->overrun_count);
+}
+
+guint seq_event_ring_get_high_watermark(struct seq_event_ring *ring)
+{
+    return (guint)g_atomic_int_get(&ring->high_watermark);
+}
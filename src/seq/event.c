@@ -1653,6 +1653,16 @@ void seq_event_copy_flattened(const ALSASeqEvent *self, guint8 *buf, gsize lengt
     }
 }
 
+// Whether the blob data of variable type follows the event in the same buffer, or not. The event
+// in the layout is available for system call without copying the blob data.
+gboolean seq_event_is_flattened(const ALSASeqEvent *self)
+{
+    if ((self->flags & SNDRV_SEQ_EVENT_LENGTH_MASK) != SNDRV_SEQ_EVENT_LENGTH_VARIABLE)
+        return TRUE;
+
+    return self->data.ext.len == 0 || self->data.ext.ptr == (const guint8 *)self + sizeof(*self);
+}
+
 // Calculate the length of event followed by allocated object for blob data at variable type. This
 // is the default layout for buffer read from ALSA Sequencer core.
 gsize seq_event_calculate_flattened_length(const ALSASeqEvent *self, gboolean aligned)
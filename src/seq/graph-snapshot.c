@@ -0,0 +1,630 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+#include "privates.h"
+
+/**
+ * ALSASeqGraphSnapshot:
+ * A boxed object to express snapshot of clients, ports, and subscriptions in ALSA Sequencer.
+ *
+ * A [struct@GraphSnapshot] keeps the information of all clients, ports, and subscriptions in
+ * ALSA Sequencer at once. It is retrieved by the call of [func@get_graph_snapshot] or
+ * [method@UserClient.query_graph_snapshot], which walks the graph with one file descriptor.
+ *
+ * The information is stored in arrays, and indexed by the numeric ID of client and the address of
+ * port, thus the information of client and port is available without any system call. The ports
+ * are indexed for each client, and the subscriptions are indexed for each port as sender and
+ * destination, thus the cost to list them is proportional to the number of entries in the list.
+ *
+ * Since: 0.4.
+ */
+struct seq_graph_edge {
+    struct snd_seq_addr sender;
+    struct snd_seq_addr dest;
+    unsigned char queue;
+    unsigned int flags;
+};
+
+struct _ALSASeqGraphSnapshot {
+    GArray *clients;
+    GArray *ports;
+    GArray *edges;
+
+    // The index of array plus one, or zero for absence.
+    guint16 client_index[256];
+    GHashTable *port_index;
+    GHashTable *edge_index;
+
+    // The numeric IDs of ports for each client.
+    GArray *client_ports[256];
+    // The keys of edges for each port as sender and destination.
+    GHashTable *sender_edges;
+    GHashTable *dest_edges;
+};
+
+#define PORT_KEY(client, port)      GUINT_TO_POINTER(((guint)(client) << 8) | (guint)(port))
+#define EDGE_KEY(sender, dest)      \
+    GUINT_TO_POINTER(((guint)(sender)->client << 24) | ((guint)(sender)->port << 16) |   \
+                     ((guint)(dest)->client << 8) | (guint)(dest)->port)
+
+ALSASeqGraphSnapshot *seq_graph_snapshot_new()
+{
+    ALSASeqGraphSnapshot *self = g_malloc0(sizeof(*self));
+
+    self->clients = g_array_new(FALSE, TRUE, sizeof(struct snd_seq_client_info));
+    self->ports = g_array_new(FALSE, TRUE, sizeof(struct snd_seq_port_info));
+    self->edges = g_array_new(FALSE, TRUE, sizeof(struct seq_graph_edge));
+    self->port_index = g_hash_table_new(g_direct_hash, g_direct_equal);
+    self->edge_index = g_hash_table_new(g_direct_hash, g_direct_equal);
+    self->sender_edges = g_hash_table_new_full(g_direct_hash, g_direct_equal, NULL,
+                                               (GDestroyNotify)g_array_unref);
+    self->dest_edges = g_hash_table_new_full(g_direct_hash, g_direct_equal, NULL,
+                                             (GDestroyNotify)g_array_unref);
+
+    return self;
+}
+
+static GArray *duplicate_array(const GArray *src, guint elem_size)
+{
+    GArray *dst = g_array_sized_new(FALSE, FALSE, elem_size, src->len);
+
+    g_array_append_vals(dst, src->data, src->len);
+
+    return dst;
+}
+
+static void duplicate_edge_lists(GHashTable *dst, GHashTable *src)
+{
+    GHashTableIter iter;
+    gpointer key, val;
+
+    g_hash_table_iter_init(&iter, src);
+    while (g_hash_table_iter_next(&iter, &key, &val))
+        g_hash_table_insert(dst, key, duplicate_array(val, sizeof(guint)));
+}
+
+static ALSASeqGraphSnapshot *seq_graph_snapshot_copy(const ALSASeqGraphSnapshot *src)
+{
+    ALSASeqGraphSnapshot *dst = seq_graph_snapshot_new();
+    GHashTableIter iter;
+    gpointer key, val;
+    int i;
+
+    g_array_append_vals(dst->clients, src->clients->data, src->clients->len);
+    g_array_append_vals(dst->ports, src->ports->data, src->ports->len);
+    g_array_append_vals(dst->edges, src->edges->data, src->edges->len);
+    memcpy(dst->client_index, src->client_index, sizeof(dst->client_index));
+
+    g_hash_table_iter_init(&iter, src->port_index);
+    while (g_hash_table_iter_next(&iter, &key, &val))
+        g_hash_table_insert(dst->port_index, key, val);
+
+    g_hash_table_iter_init(&iter, src->edge_index);
+    while (g_hash_table_iter_next(&iter, &key, &val))
+        g_hash_table_insert(dst->edge_index, key, val);
+
+    for (i = 0; i < G_N_ELEMENTS(src->client_ports); ++i) {
+        if (src->client_ports[i] != NULL)
+            dst->client_ports[i] = duplicate_array(src->client_ports[i], sizeof(guint8));
+    }
+
+    duplicate_edge_lists(dst->sender_edges, src->sender_edges);
+    duplicate_edge_lists(dst->dest_edges, src->dest_edges);
+
+    return dst;
+}
+
+void seq_graph_snapshot_free(ALSASeqGraphSnapshot *self)
+{
+    int i;
+
+    for (i = 0; i < G_N_ELEMENTS(self->client_ports); ++i) {
+        if (self->client_ports[i] != NULL)
+            g_array_unref(self->client_ports[i]);
+    }
+    g_hash_table_unref(self->sender_edges);
+    g_hash_table_unref(self->dest_edges);
+    g_array_unref(self->clients);
+    g_array_unref(self->ports);
+    g_array_unref(self->edges);
+    g_hash_table_unref(self->port_index);
+    g_hash_table_unref(self->edge_index);
+    g_free(self);
+}
+
+G_DEFINE_BOXED_TYPE(ALSASeqGraphSnapshot, alsaseq_graph_snapshot, seq_graph_snapshot_copy,
+                    seq_graph_snapshot_free)
+
+static const struct snd_seq_client_info *find_client(const ALSASeqGraphSnapshot *self,
+                                                     guint8 client_id)
+{
+    guint index = self->client_index[client_id];
+
+    if (index == 0)
+        return NULL;
+
+    return &g_array_index(self->clients, struct snd_seq_client_info, index - 1);
+}
+
+static const struct snd_seq_port_info *find_port(const ALSASeqGraphSnapshot *self,
+                                                 guint8 client_id, guint8 port_id)
+{
+    guint index = GPOINTER_TO_UINT(g_hash_table_lookup(self->port_index,
+                                                       PORT_KEY(client_id, port_id)));
+
+    if (index == 0)
+        return NULL;
+
+    return &g_array_index(self->ports, struct snd_seq_port_info, index - 1);
+}
+
+static const struct seq_graph_edge *find_edge(const ALSASeqGraphSnapshot *self, guint edge_key)
+{
+    guint index = GPOINTER_TO_UINT(g_hash_table_lookup(self->edge_index,
+                                                       GUINT_TO_POINTER(edge_key)));
+
+    if (index == 0)
+        return NULL;
+
+    return &g_array_index(self->edges, struct seq_graph_edge, index - 1);
+}
+
+static void append_edge_key(GHashTable *edge_lists, gpointer port_key, guint edge_key)
+{
+    GArray *list = g_hash_table_lookup(edge_lists, port_key);
+
+    if (list == NULL) {
+        list = g_array_new(FALSE, FALSE, sizeof(guint));
+        g_hash_table_insert(edge_lists, port_key, list);
+    }
+
+    g_array_append_val(list, edge_key);
+}
+
+// The cost is proportional to the number of edges for the port.
+static void remove_edge_key(GHashTable *edge_lists, gpointer port_key, guint edge_key)
+{
+    GArray *list = g_hash_table_lookup(edge_lists, port_key);
+    guint i;
+
+    if (list == NULL)
+        return;
+
+    for (i = 0; i < list->len; ++i) {
+        if (g_array_index(list, guint, i) == edge_key) {
+            g_array_remove_index_fast(list, i);
+            break;
+        }
+    }
+
+    if (list->len == 0)
+        g_hash_table_remove(edge_lists, port_key);
+}
+
+// The functions to update return TRUE when the entry is newly added.
+
+gboolean seq_graph_snapshot_update_client(ALSASeqGraphSnapshot *self,
+                                          const struct snd_seq_client_info *info)
+{
+    guint8 client_id = (guint8)info->client;
+    guint index = self->client_index[client_id];
+
+    if (index > 0) {
+        g_array_index(self->clients, struct snd_seq_client_info, index - 1) = *info;
+        return FALSE;
+    }
+
+    g_array_append_val(self->clients, *info);
+    self->client_index[client_id] = self->clients->len;
+
+    return TRUE;
+}
+
+gboolean seq_graph_snapshot_update_port(ALSASeqGraphSnapshot *self,
+                                        const struct snd_seq_port_info *info)
+{
+    gpointer key = PORT_KEY(info->addr.client, info->addr.port);
+    guint index = GPOINTER_TO_UINT(g_hash_table_lookup(self->port_index, key));
+
+    if (index > 0) {
+        g_array_index(self->ports, struct snd_seq_port_info, index - 1) = *info;
+        return FALSE;
+    }
+
+    g_array_append_val(self->ports, *info);
+    g_hash_table_insert(self->port_index, key, GUINT_TO_POINTER(self->ports->len));
+
+    if (self->client_ports[info->addr.client] == NULL)
+        self->client_ports[info->addr.client] = g_array_new(FALSE, FALSE, sizeof(guint8));
+    g_array_append_val(self->client_ports[info->addr.client], info->addr.port);
+
+    return TRUE;
+}
+
+gboolean seq_graph_snapshot_add_subscription(ALSASeqGraphSnapshot *self,
+                                             const struct snd_seq_addr *sender,
+                                             const struct snd_seq_addr *dest, unsigned char queue,
+                                             unsigned int flags)
+{
+    gpointer key = EDGE_KEY(sender, dest);
+    guint index = GPOINTER_TO_UINT(g_hash_table_lookup(self->edge_index, key));
+    struct seq_graph_edge edge = {
+        .sender = *sender,
+        .dest = *dest,
+        .queue = queue,
+        .flags = flags,
+    };
+
+    if (index > 0) {
+        g_array_index(self->edges, struct seq_graph_edge, index - 1) = edge;
+        return FALSE;
+    }
+
+    g_array_append_val(self->edges, edge);
+    g_hash_table_insert(self->edge_index, key, GUINT_TO_POINTER(self->edges->len));
+
+    append_edge_key(self->sender_edges, PORT_KEY(sender->client, sender->port),
+                    GPOINTER_TO_UINT(key));
+    append_edge_key(self->dest_edges, PORT_KEY(dest->client, dest->port), GPOINTER_TO_UINT(key));
+
+    return TRUE;
+}
+
+// NOTE: The entry is removed by moving the last entry to the position so that the removal costs
+// O(1) in the array. The index of moved entry is updated accordingly. The lists indexed for the
+// client and the port are scanned, thus the cost is proportional to the number of entries in them.
+
+gboolean seq_graph_snapshot_remove_subscription(ALSASeqGraphSnapshot *self,
+                                                const struct snd_seq_addr *sender,
+                                                const struct snd_seq_addr *dest)
+{
+    gpointer key = EDGE_KEY(sender, dest);
+    guint index = GPOINTER_TO_UINT(g_hash_table_lookup(self->edge_index, key));
+
+    if (index == 0)
+        return FALSE;
+
+    remove_edge_key(self->sender_edges, PORT_KEY(sender->client, sender->port),
+                    GPOINTER_TO_UINT(key));
+    remove_edge_key(self->dest_edges, PORT_KEY(dest->client, dest->port), GPOINTER_TO_UINT(key));
+
+    g_hash_table_remove(self->edge_index, key);
+    g_array_remove_index_fast(self->edges, index - 1);
+    if (index - 1 < self->edges->len) {
+        const struct seq_graph_edge *moved =
+            &g_array_index(self->edges, struct seq_graph_edge, index - 1);
+
+        g_hash_table_insert(self->edge_index, EDGE_KEY(&moved->sender, &moved->dest),
+                            GUINT_TO_POINTER(index));
+    }
+
+    return TRUE;
+}
+
+static void remove_port_edges(ALSASeqGraphSnapshot *self, GHashTable *edge_lists,
+                              gpointer port_key)
+{
+    GArray *list;
+
+    // The list is released when the last edge is removed.
+    while ((list = g_hash_table_lookup(edge_lists, port_key)) != NULL) {
+        guint edge_key = g_array_index(list, guint, list->len - 1);
+        const struct seq_graph_edge *edge = find_edge(self, edge_key);
+        struct snd_seq_addr sender;
+        struct snd_seq_addr dest;
+
+        if (edge == NULL) {
+            remove_edge_key(edge_lists, port_key, edge_key);
+            continue;
+        }
+
+        sender = edge->sender;
+        dest = edge->dest;
+        seq_graph_snapshot_remove_subscription(self, &sender, &dest);
+    }
+}
+
+gboolean seq_graph_snapshot_remove_port(ALSASeqGraphSnapshot *self, guint8 client_id,
+                                        guint8 port_id)
+{
+    gpointer key = PORT_KEY(client_id, port_id);
+    guint index = GPOINTER_TO_UINT(g_hash_table_lookup(self->port_index, key));
+    GArray *port_ids = self->client_ports[client_id];
+    guint i;
+
+    if (index == 0)
+        return FALSE;
+
+    if (port_ids != NULL) {
+        for (i = 0; i < port_ids->len; ++i) {
+            if (g_array_index(port_ids, guint8, i) == port_id) {
+                g_array_remove_index_fast(port_ids, i);
+                break;
+            }
+        }
+    }
+
+    g_hash_table_remove(self->port_index, key);
+    g_array_remove_index_fast(self->ports, index - 1);
+    if (index - 1 < self->ports->len) {
+        const struct snd_seq_port_info *moved =
+            &g_array_index(self->ports, struct snd_seq_port_info, index - 1);
+
+        g_hash_table_insert(self->port_index, PORT_KEY(moved->addr.client, moved->addr.port),
+                            GUINT_TO_POINTER(index));
+    }
+
+    // ALSA Sequencer core announces the removal of subscriptions as well, while the remaining ones
+    // are removed just in case.
+    remove_port_edges(self, self->sender_edges, key);
+    remove_port_edges(self, self->dest_edges, key);
+
+    return TRUE;
+}
+
+gboolean seq_graph_snapshot_remove_client(ALSASeqGraphSnapshot *self, guint8 client_id)
+{
+    guint index = self->client_index[client_id];
+    GArray *port_ids;
+
+    if (index == 0)
+        return FALSE;
+
+    self->client_index[client_id] = 0;
+    g_array_remove_index_fast(self->clients, index - 1);
+    if (index - 1 < self->clients->len) {
+        const struct snd_seq_client_info *moved =
+            &g_array_index(self->clients, struct snd_seq_client_info, index - 1);
+
+        self->client_index[(guint8)moved->client] = index;
+    }
+
+    port_ids = self->client_ports[client_id];
+    if (port_ids != NULL) {
+        while (port_ids->len > 0) {
+            guint8 port_id = g_array_index(port_ids, guint8, port_ids->len - 1);
+
+            if (!seq_graph_snapshot_remove_port(self, client_id, port_id))
+                g_array_remove_index_fast(port_ids, port_ids->len - 1);
+        }
+
+        g_array_unref(port_ids);
+        self->client_ports[client_id] = NULL;
+    }
+
+    return TRUE;
+}
+
+// The functions to find return any entry for the client or the port, so that the entries are
+// removed one by one without scanning the whole arrays.
+
+gboolean seq_graph_snapshot_find_client_port(const ALSASeqGraphSnapshot *self, guint8 client_id,
+                                             guint8 *port_id)
+{
+    const GArray *port_ids = self->client_ports[client_id];
+
+    if (port_ids == NULL || port_ids->len == 0)
+        return FALSE;
+
+    *port_id = g_array_index(port_ids, guint8, port_ids->len - 1);
+
+    return TRUE;
+}
+
+gboolean seq_graph_snapshot_find_port_subscription(const ALSASeqGraphSnapshot *self,
+                                                   const struct snd_seq_addr *addr,
+                                                   struct snd_seq_addr *sender,
+                                                   struct snd_seq_addr *dest)
+{
+    GHashTable *edge_lists[] = { self->sender_edges, self->dest_edges };
+    int i;
+
+    for (i = 0; i < G_N_ELEMENTS(edge_lists); ++i) {
+        const GArray *list = g_hash_table_lookup(edge_lists[i],
+                                                 PORT_KEY(addr->client, addr->port));
+        const struct seq_graph_edge *edge;
+
+        if (list == NULL || list->len == 0)
+            continue;
+
+        edge = find_edge(self, g_array_index(list, guint, list->len - 1));
+        if (edge == NULL)
+            continue;
+
+        *sender = edge->sender;
+        *dest = edge->dest;
+
+        return TRUE;
+    }
+
+    return FALSE;
+}
+
+/**
+ * alsaseq_graph_snapshot_get_client_id_list:
+ * @self: A [struct@GraphSnapshot].
+ * @entries: (array length=entry_count)(out): The array with elements for numeric identifier of
+ *           client.
+ * @entry_count: The number of entries.
+ *
+ * Get the list of clients in the snapshot as the numeric identifier.
+ *
+ * Since: 0.4.
+ */
+void alsaseq_graph_snapshot_get_client_id_list(const ALSASeqGraphSnapshot *self, guint8 **entries,
+                                               gsize *entry_count)
+{
+    guint8 *list;
+    int i;
+
+    g_return_if_fail(self != NULL);
+    g_return_if_fail(entries != NULL);
+    g_return_if_fail(entry_count != NULL);
+
+    list = g_malloc0_n(self->clients->len, sizeof(*list));
+    for (i = 0; i < self->clients->len; ++i)
+        list[i] = g_array_index(self->clients, struct snd_seq_client_info, i).client;
+
+    *entries = list;
+    *entry_count = self->clients->len;
+}
+
+/**
+ * alsaseq_graph_snapshot_get_client_info:
+ * @self: A [struct@GraphSnapshot].
+ * @client_id: The numeric identifier of client.
+ * @client_info: (out): A [class@ClientInfo] for the client.
+ *
+ * Get the information of client in the snapshot according to the numeric ID.
+ *
+ * Returns: %TRUE when the client is included in the snapshot, else %FALSE.
+ *
+ * Since: 0.4.
+ */
+gboolean alsaseq_graph_snapshot_get_client_info(const ALSASeqGraphSnapshot *self,
+                                                guint8 client_id,
+                                                ALSASeqClientInfo **client_info)
+{
+    const struct snd_seq_client_info *src;
+    struct snd_seq_client_info *dst;
+
+    g_return_val_if_fail(self != NULL, FALSE);
+    g_return_val_if_fail(client_info != NULL, FALSE);
+
+    src = find_client(self, client_id);
+    if (src == NULL)
+        return FALSE;
+
+    *client_info = g_object_new(ALSASEQ_TYPE_CLIENT_INFO, NULL);
+    seq_client_info_refer_private(*client_info, &dst);
+    *dst = *src;
+
+    return TRUE;
+}
+
+/**
+ * alsaseq_graph_snapshot_get_port_id_list:
+ * @self: A [struct@GraphSnapshot].
+ * @client_id: The numeric identifier of client.
+ * @entries: (array length=entry_count)(out): The array with elements for numeric identifier of
+ *           port.
+ * @entry_count: The number of entries.
+ *
+ * Get the list of ports added by the client in the snapshot as the numeric identifier.
+ *
+ * Returns: %TRUE when the client is included in the snapshot, else %FALSE.
+ *
+ * Since: 0.4.
+ */
+gboolean alsaseq_graph_snapshot_get_port_id_list(const ALSASeqGraphSnapshot *self,
+                                                 guint8 client_id, guint8 **entries,
+                                                 gsize *entry_count)
+{
+    const GArray *port_ids;
+    guint8 *list;
+    gsize count;
+
+    g_return_val_if_fail(self != NULL, FALSE);
+    g_return_val_if_fail(entries != NULL, FALSE);
+    g_return_val_if_fail(entry_count != NULL, FALSE);
+
+    if (find_client(self, client_id) == NULL)
+        return FALSE;
+
+    port_ids = self->client_ports[client_id];
+    count = port_ids != NULL ? port_ids->len : 0;
+
+    list = g_malloc0_n(count, sizeof(*list));
+    if (count > 0)
+        memcpy(list, port_ids->data, count * sizeof(*list));
+
+    *entries = list;
+    *entry_count = count;
+
+    return TRUE;
+}
+
+/**
+ * alsaseq_graph_snapshot_get_port_info:
+ * @self: A [struct@GraphSnapshot].
+ * @client_id: The numeric identifier of client.
+ * @port_id: The numeric identifier of port in the client.
+ * @port_info: (out): A [class@PortInfo] for the port.
+ *
+ * Get the information of port in the snapshot according to the address.
+ *
+ * Returns: %TRUE when the port is included in the snapshot, else %FALSE.
+ *
+ * Since: 0.4.
+ */
+gboolean alsaseq_graph_snapshot_get_port_info(const ALSASeqGraphSnapshot *self, guint8 client_id,
+                                              guint8 port_id, ALSASeqPortInfo **port_info)
+{
+    const struct snd_seq_port_info *src;
+    struct snd_seq_port_info *dst;
+
+    g_return_val_if_fail(self != NULL, FALSE);
+    g_return_val_if_fail(port_info != NULL, FALSE);
+
+    src = find_port(self, client_id, port_id);
+    if (src == NULL)
+        return FALSE;
+
+    *port_info = g_object_new(ALSASEQ_TYPE_PORT_INFO, NULL);
+    seq_port_info_refer_private(*port_info, &dst);
+    *dst = *src;
+
+    return TRUE;
+}
+
+/**
+ * alsaseq_graph_snapshot_get_subscription_list:
+ * @self: A [struct@GraphSnapshot].
+ * @addr: A [struct@Addr] to query.
+ * @query_type: The type of query, one of [enum@QuerySubscribeType].
+ * @entries: (element-type ALSASeq.SubscribeData)(out): The list with element for subscription
+ *           data.
+ *
+ * Get the list of subscription in the snapshot for given address and query type.
+ *
+ * Since: 0.4.
+ */
+void alsaseq_graph_snapshot_get_subscription_list(const ALSASeqGraphSnapshot *self,
+                                                  const ALSASeqAddr *addr,
+                                                  ALSASeqQuerySubscribeType query_type,
+                                                  GList **entries)
+{
+    const GArray *list;
+    GList *head = NULL;
+    int i;
+
+    g_return_if_fail(self != NULL);
+    g_return_if_fail(addr != NULL);
+    g_return_if_fail(entries != NULL);
+
+    if (query_type == ALSASEQ_QUERY_SUBSCRIBE_TYPE_READ)
+        list = g_hash_table_lookup(self->sender_edges, PORT_KEY(addr->client, addr->port));
+    else
+        list = g_hash_table_lookup(self->dest_edges, PORT_KEY(addr->client, addr->port));
+
+    if (list == NULL)
+        return;
+
+    for (i = 0; i < list->len; ++i) {
+        const struct seq_graph_edge *edge = find_edge(self, g_array_index(list, guint, i));
+        ALSASeqSubscribeData *subs_data;
+        struct snd_seq_port_subscribe *data;
+
+        if (edge == NULL)
+            continue;
+
+        subs_data = g_object_new(ALSASEQ_TYPE_SUBSCRIBE_DATA, NULL);
+        seq_subscribe_data_refer_private(subs_data, &data);
+        data->sender = edge->sender;
+        data->dest = edge->dest;
+        data->queue = edge->queue;
+        data->flags = edge->flags;
+
+        head = g_list_prepend(head, subs_data);
+    }
+
+    *entries = g_list_concat(*entries, g_list_reverse(head));
+}
@@ -0,0 +1,34 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+#ifndef __ALSA_GOBJECT_ALSASEQ_GRAPH_SNAPSHOT_H__
+#define __ALSA_GOBJECT_ALSASEQ_GRAPH_SNAPSHOT_H__
+
+#include <alsaseq.h>
+
+G_BEGIN_DECLS
+
+#define ALSASEQ_TYPE_GRAPH_SNAPSHOT     (alsaseq_graph_snapshot_get_type())
+
+typedef struct _ALSASeqGraphSnapshot ALSASeqGraphSnapshot;
+
+GType alsaseq_graph_snapshot_get_type() G_GNUC_CONST;
+
+void alsaseq_graph_snapshot_get_client_id_list(const ALSASeqGraphSnapshot *self, guint8 **entries,
+                                               gsize *entry_count);
+gboolean alsaseq_graph_snapshot_get_client_info(const ALSASeqGraphSnapshot *self,
+                                                guint8 client_id,
+                                                ALSASeqClientInfo **client_info);
+
+gboolean alsaseq_graph_snapshot_get_port_id_list(const ALSASeqGraphSnapshot *self,
+                                                 guint8 client_id, guint8 **entries,
+                                                 gsize *entry_count);
+gboolean alsaseq_graph_snapshot_get_port_info(const ALSASeqGraphSnapshot *self, guint8 client_id,
+                                              guint8 port_id, ALSASeqPortInfo **port_info);
+
+void alsaseq_graph_snapshot_get_subscription_list(const ALSASeqGraphSnapshot *self,
+                                                  const ALSASeqAddr *addr,
+                                                  ALSASeqQuerySubscribeType query_type,
+                                                  GList **entries);
+
+G_END_DECLS
+
+#endif
@@ -0,0 +1,470 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+#include "privates.h"
+
+/**
+ * ALSASeqLiveGraph:
+ * An object to maintain the graph of clients, ports, and subscriptions in ALSA Sequencer.
+ *
+ * A [class@LiveGraph] keeps [struct@GraphSnapshot] up to date. The call of
+ * [method@LiveGraph.attach] subscribes the system announce port of system client with the port of
+ * [class@UserClient], then takes the snapshot. After that, the events delivered from the system
+ * announce port are applied to the snapshot as delta, and the change is notified by
+ * [signal@LiveGraph::client-changed], [signal@LiveGraph::port-changed], and
+ * [signal@LiveGraph::subscription-changed] signals.
+ *
+ * The events are retrieved from [signal@UserClient::handle-event] signal. When the events are
+ * handled by the function installed by [method@UserClient.set_event_handler], the call of
+ * [method@LiveGraph.apply_event_cntr] should be done in the function instead.
+ *
+ * The events delivered before the snapshot is taken can be applied again. The `START` events for
+ * the client and the port already included in the snapshot are ignored.
+ *
+ * When the filter configured by [method@UserClient.set_event_type_filter] excludes the types of
+ * event from the system announce port, ALSA Sequencer core does not deliver them to the client.
+ * In the case, the graph is not updated without any notification.
+ *
+ * Since: 0.4.
+ */
+typedef struct {
+    ALSASeqUserClient *client;
+    guint8 port_id;
+    gulong handler_id;
+    ALSASeqGraphSnapshot *snapshot;
+} ALSASeqLiveGraphPrivate;
+G_DEFINE_TYPE_WITH_PRIVATE(ALSASeqLiveGraph, alsaseq_live_graph, G_TYPE_OBJECT)
+
+enum seq_live_graph_sig_type {
+    SEQ_LIVE_GRAPH_SIG_CLIENT_CHANGED = 0,
+    SEQ_LIVE_GRAPH_SIG_PORT_CHANGED,
+    SEQ_LIVE_GRAPH_SIG_SUBSCRIPTION_CHANGED,
+    SEQ_LIVE_GRAPH_SIG_COUNT,
+};
+static guint seq_live_graph_sigs[SEQ_LIVE_GRAPH_SIG_COUNT] = { 0 };
+
+static void seq_live_graph_finalize(GObject *obj)
+{
+    ALSASeqLiveGraph *self = ALSASEQ_LIVE_GRAPH(obj);
+
+    alsaseq_live_graph_detach(self);
+
+    G_OBJECT_CLASS(alsaseq_live_graph_parent_class)->finalize(obj);
+}
+
+static void alsaseq_live_graph_class_init(ALSASeqLiveGraphClass *klass)
+{
+    GObjectClass *gobject_class = G_OBJECT_CLASS(klass);
+
+    gobject_class->finalize = seq_live_graph_finalize;
+
+    /**
+     * ALSASeqLiveGraph::client-changed:
+     * @self: A [class@LiveGraph].
+     * @client_id: The numeric ID of client.
+     * @change_type: The type of change, one of [enum@GraphChangeType].
+     *
+     * Emitted when the client is added, removed, or updated in the graph.
+     *
+     * Since: 0.4.
+     */
+    seq_live_graph_sigs[SEQ_LIVE_GRAPH_SIG_CLIENT_CHANGED] =
+        g_signal_new("client-changed",
+                     G_OBJECT_CLASS_TYPE(klass),
+                     G_SIGNAL_RUN_LAST,
+                     G_STRUCT_OFFSET(ALSASeqLiveGraphClass, client_changed),
+                     NULL, NULL,
+                     NULL,
+                     G_TYPE_NONE, 2, G_TYPE_UCHAR, ALSASEQ_TYPE_GRAPH_CHANGE_TYPE);
+
+    /**
+     * ALSASeqLiveGraph::port-changed:
+     * @self: A [class@LiveGraph].
+     * @client_id: The numeric ID of client.
+     * @port_id: The numeric ID of port.
+     * @change_type: The type of change, one of [enum@GraphChangeType].
+     *
+     * Emitted when the port is added, removed, or updated in the graph.
+     *
+     * Since: 0.4.
+     */
+    seq_live_graph_sigs[SEQ_LIVE_GRAPH_SIG_PORT_CHANGED] =
+        g_signal_new("port-changed",
+                     G_OBJECT_CLASS_TYPE(klass),
+                     G_SIGNAL_RUN_LAST,
+                     G_STRUCT_OFFSET(ALSASeqLiveGraphClass, port_changed),
+                     NULL, NULL,
+                     NULL,
+                     G_TYPE_NONE, 3, G_TYPE_UCHAR, G_TYPE_UCHAR,
+                     ALSASEQ_TYPE_GRAPH_CHANGE_TYPE);
+
+    /**
+     * ALSASeqLiveGraph::subscription-changed:
+     * @self: A [class@LiveGraph].
+     * @sender: (transfer none): The address of sender.
+     * @dest: (transfer none): The address of destination.
+     * @change_type: The type of change, one of [enum@GraphChangeType].
+     *
+     * Emitted when the subscription is added or removed in the graph.
+     *
+     * Since: 0.4.
+     */
+    seq_live_graph_sigs[SEQ_LIVE_GRAPH_SIG_SUBSCRIPTION_CHANGED] =
+        g_signal_new("subscription-changed",
+                     G_OBJECT_CLASS_TYPE(klass),
+                     G_SIGNAL_RUN_LAST,
+                     G_STRUCT_OFFSET(ALSASeqLiveGraphClass, subscription_changed),
+                     NULL, NULL,
+                     NULL,
+                     G_TYPE_NONE, 3, ALSASEQ_TYPE_ADDR | G_SIGNAL_TYPE_STATIC_SCOPE,
+                     ALSASEQ_TYPE_ADDR | G_SIGNAL_TYPE_STATIC_SCOPE,
+                     ALSASEQ_TYPE_GRAPH_CHANGE_TYPE);
+}
+
+static void alsaseq_live_graph_init(ALSASeqLiveGraph *self)
+{
+    return;
+}
+
+/**
+ * alsaseq_live_graph_new:
+ *
+ * Allocate and return an instance of [class@LiveGraph].
+ *
+ * Returns: An instance of [class@LiveGraph].
+ *
+ * Since: 0.4.
+ */
+ALSASeqLiveGraph *alsaseq_live_graph_new()
+{
+    return g_object_new(ALSASEQ_TYPE_LIVE_GRAPH, NULL);
+}
+
+static void handle_event_cntr(ALSASeqUserClient *client, const ALSASeqEventCntr *ev_cntr,
+                              gpointer user_data)
+{
+    alsaseq_live_graph_apply_event_cntr(ALSASEQ_LIVE_GRAPH(user_data), ev_cntr);
+}
+
+static gboolean operate_announce_subscription(ALSASeqUserClient *client, guint8 port_id,
+                                              gboolean establish, GError **error)
+{
+    ALSASeqSubscribeData *subs_data;
+    struct snd_seq_port_subscribe *data;
+    guint8 client_id;
+    gboolean result;
+
+    g_object_get(client, "client-id", &client_id, NULL);
+
+    subs_data = alsaseq_subscribe_data_new();
+    seq_subscribe_data_refer_private(subs_data, &data);
+    data->sender.client = SNDRV_SEQ_CLIENT_SYSTEM;
+    data->sender.port = SNDRV_SEQ_PORT_SYSTEM_ANNOUNCE;
+    data->dest.client = client_id;
+    data->dest.port = port_id;
+
+    result = alsaseq_user_client_operate_subscription(client, subs_data, establish, error);
+    g_object_unref(subs_data);
+
+    return result;
+}
+
+/**
+ * alsaseq_live_graph_attach:
+ * @self: A [class@LiveGraph].
+ * @client: A [class@UserClient] to receive events from the system announce port.
+ * @port_id: The numeric ID of port in the client to receive the events.
+ * @error: A [struct@GLib.Error]. Error is generated with domain of `ALSASeq.UserClientError` or
+ *         `GLib.FileError`.
+ *
+ * Subscribe the system announce port of system client with the port of client, then take the
+ * snapshot of graph. The port should be added with [flags@PortCapFlag].WRITE and
+ * [flags@PortCapFlag].SUBS_WRITE in advance.
+ *
+ * Returns: %TRUE when the overall operation finishes successfully, else %FALSE.
+ *
+ * Since: 0.4.
+ */
+gboolean alsaseq_live_graph_attach(ALSASeqLiveGraph *self, ALSASeqUserClient *client,
+                                   guint8 port_id, GError **error)
+{
+    ALSASeqLiveGraphPrivate *priv;
+
+    g_return_val_if_fail(ALSASEQ_IS_LIVE_GRAPH(self), FALSE);
+    priv = alsaseq_live_graph_get_instance_private(self);
+    g_return_val_if_fail(priv->client == NULL, FALSE);
+
+    g_return_val_if_fail(ALSASEQ_IS_USER_CLIENT(client), FALSE);
+    g_return_val_if_fail(error == NULL || *error == NULL, FALSE);
+
+    // NOTE: The subscription is established before taking the snapshot so that no change is lost.
+    // The events for the changes already included in the snapshot are applied without any effect.
+    if (!operate_announce_subscription(client, port_id, TRUE, error))
+        return FALSE;
+
+    if (!alsaseq_user_client_query_graph_snapshot(client, &priv->snapshot, error)) {
+        operate_announce_subscription(client, port_id, FALSE, NULL);
+        return FALSE;
+    }
+
+    priv->client = g_object_ref(client);
+    priv->port_id = port_id;
+    priv->handler_id = g_signal_connect(client, "handle-event", G_CALLBACK(handle_event_cntr),
+                                        self);
+
+    return TRUE;
+}
+
+/**
+ * alsaseq_live_graph_detach:
+ * @self: A [class@LiveGraph].
+ *
+ * Unsubscribe the system announce port, then release the snapshot of graph.
+ *
+ * Since: 0.4.
+ */
+void alsaseq_live_graph_detach(ALSASeqLiveGraph *self)
+{
+    ALSASeqLiveGraphPrivate *priv;
+
+    g_return_if_fail(ALSASEQ_IS_LIVE_GRAPH(self));
+    priv = alsaseq_live_graph_get_instance_private(self);
+
+    if (priv->client == NULL)
+        return;
+
+    g_signal_handler_disconnect(priv->client, priv->handler_id);
+    operate_announce_subscription(priv->client, priv->port_id, FALSE, NULL);
+    g_object_unref(priv->client);
+    priv->client = NULL;
+
+    seq_graph_snapshot_free(priv->snapshot);
+    priv->snapshot = NULL;
+}
+
+static void emit_subscription_changed(ALSASeqLiveGraph *self, const struct snd_seq_addr *sender,
+                                      const struct snd_seq_addr *dest,
+                                      ALSASeqGraphChangeType change_type)
+{
+    g_signal_emit(self, seq_live_graph_sigs[SEQ_LIVE_GRAPH_SIG_SUBSCRIPTION_CHANGED], 0,
+                  sender, dest, change_type);
+}
+
+static void apply_client(ALSASeqLiveGraph *self, ALSASeqLiveGraphPrivate *priv, guint8 client_id,
+                         gboolean started)
+{
+    ALSASeqClientInfo *client_info;
+    struct snd_seq_client_info *info;
+    ALSASeqGraphChangeType change_type;
+
+    if (!alsaseq_user_client_query_client_info(priv->client, client_id, &client_info, NULL))
+        return;
+    seq_client_info_refer_private(client_info, &info);
+
+    if (seq_graph_snapshot_update_client(priv->snapshot, info))
+        change_type = ALSASEQ_GRAPH_CHANGE_TYPE_ADDED;
+    else
+        change_type = ALSASEQ_GRAPH_CHANGE_TYPE_UPDATED;
+    g_object_unref(client_info);
+
+    // The event delivered before taking the snapshot is replayed.
+    if (started && change_type == ALSASEQ_GRAPH_CHANGE_TYPE_UPDATED)
+        return;
+
+    g_signal_emit(self, seq_live_graph_sigs[SEQ_LIVE_GRAPH_SIG_CLIENT_CHANGED], 0, client_id,
+                  change_type);
+}
+
+static void apply_port(ALSASeqLiveGraph *self, ALSASeqLiveGraphPrivate *priv,
+                       const struct snd_seq_addr *addr, gboolean started)
+{
+    ALSASeqPortInfo *port_info;
+    struct snd_seq_port_info *info;
+    ALSASeqGraphChangeType change_type;
+
+    if (!alsaseq_user_client_query_port_info(priv->client, addr->client, addr->port, &port_info,
+                                             NULL))
+        return;
+    seq_port_info_refer_private(port_info, &info);
+
+    if (seq_graph_snapshot_update_port(priv->snapshot, info))
+        change_type = ALSASEQ_GRAPH_CHANGE_TYPE_ADDED;
+    else
+        change_type = ALSASEQ_GRAPH_CHANGE_TYPE_UPDATED;
+    g_object_unref(port_info);
+
+    // The event delivered before taking the snapshot is replayed.
+    if (started && change_type == ALSASEQ_GRAPH_CHANGE_TYPE_UPDATED)
+        return;
+
+    g_signal_emit(self, seq_live_graph_sigs[SEQ_LIVE_GRAPH_SIG_PORT_CHANGED], 0, addr->client,
+                  addr->port, change_type);
+}
+
+// NOTE: The graph can be detached in any handler of signal, then the snapshot is released.
+
+static void remove_subscriptions(ALSASeqLiveGraph *self, ALSASeqLiveGraphPrivate *priv,
+                                 const struct snd_seq_addr *addr)
+{
+    struct snd_seq_addr sender;
+    struct snd_seq_addr dest;
+
+    // The subscriptions are indexed for the port, thus the cost is proportional to the number of
+    // subscriptions for the port.
+    while (priv->snapshot != NULL &&
+           seq_graph_snapshot_find_port_subscription(priv->snapshot, addr, &sender, &dest)) {
+        if (!seq_graph_snapshot_remove_subscription(priv->snapshot, &sender, &dest))
+            break;
+        emit_subscription_changed(self, &sender, &dest, ALSASEQ_GRAPH_CHANGE_TYPE_REMOVED);
+    }
+}
+
+static void remove_port(ALSASeqLiveGraph *self, ALSASeqLiveGraphPrivate *priv,
+                        const struct snd_seq_addr *addr)
+{
+    // ALSA Sequencer core announces the removal of subscriptions in advance, while the remaining
+    // ones are notified as well.
+    remove_subscriptions(self, priv, addr);
+
+    if (priv->snapshot != NULL &&
+        seq_graph_snapshot_remove_port(priv->snapshot, addr->client, addr->port)) {
+        g_signal_emit(self, seq_live_graph_sigs[SEQ_LIVE_GRAPH_SIG_PORT_CHANGED], 0,
+                      addr->client, addr->port, ALSASEQ_GRAPH_CHANGE_TYPE_REMOVED);
+    }
+}
+
+static void remove_client(ALSASeqLiveGraph *self, ALSASeqLiveGraphPrivate *priv,
+                          guint8 client_id)
+{
+    guint8 port_id;
+
+    // The ports are indexed for the client, and removed one by one.
+    while (priv->snapshot != NULL &&
+           seq_graph_snapshot_find_client_port(priv->snapshot, client_id, &port_id)) {
+        struct snd_seq_addr addr = { .client = client_id, .port = port_id };
+
+        remove_port(self, priv, &addr);
+    }
+
+    if (priv->snapshot != NULL && seq_graph_snapshot_remove_client(priv->snapshot, client_id)) {
+        g_signal_emit(self, seq_live_graph_sigs[SEQ_LIVE_GRAPH_SIG_CLIENT_CHANGED], 0, client_id,
+                      ALSASEQ_GRAPH_CHANGE_TYPE_REMOVED);
+    }
+}
+
+static void apply_subscription(ALSASeqLiveGraph *self, ALSASeqLiveGraphPrivate *priv,
+                               const struct snd_seq_connect *connect, gboolean established)
+{
+    if (established) {
+        struct snd_seq_port_subscribe data = {0};
+
+        data.sender = connect->sender;
+        data.dest = connect->dest;
+        if (!seq_user_client_get_subscription(priv->client, &data))
+            return;
+
+        if (seq_graph_snapshot_add_subscription(priv->snapshot, &data.sender, &data.dest,
+                                                data.queue, data.flags)) {
+            emit_subscription_changed(self, &connect->sender, &connect->dest,
+                                      ALSASEQ_GRAPH_CHANGE_TYPE_ADDED);
+        }
+    } else if (seq_graph_snapshot_remove_subscription(priv->snapshot, &connect->sender,
+                                                      &connect->dest)) {
+        emit_subscription_changed(self, &connect->sender, &connect->dest,
+                                  ALSASEQ_GRAPH_CHANGE_TYPE_REMOVED);
+    }
+}
+
+/**
+ * alsaseq_live_graph_apply_event_cntr:
+ * @self: A [class@LiveGraph].
+ * @ev_cntr: A [struct@EventCntr] including events from the system announce port.
+ *
+ * Apply the events delivered from the system announce port to the graph. The other events are
+ * ignored. The call of function is done internally for [signal@UserClient::handle-event] signal.
+ *
+ * Since: 0.4.
+ */
+void alsaseq_live_graph_apply_event_cntr(ALSASeqLiveGraph *self, const ALSASeqEventCntr *ev_cntr)
+{
+    ALSASeqLiveGraphPrivate *priv;
+    ALSASeqEventCntrIter iter;
+    const struct snd_seq_event *ev;
+
+    g_return_if_fail(ALSASEQ_IS_LIVE_GRAPH(self));
+    priv = alsaseq_live_graph_get_instance_private(self);
+
+    g_return_if_fail(ev_cntr != NULL);
+
+    if (priv->client == NULL)
+        return;
+
+    // NOTE: The announce events are fixed length, thus the buffer of container is not modified.
+    seq_event_iter_init(&iter, ev_cntr->buf, ev_cntr->length, ev_cntr->aligned);
+    while ((ev = seq_event_iter_next(&iter))) {
+        if (ev->source.client != SNDRV_SEQ_CLIENT_SYSTEM ||
+            ev->source.port != SNDRV_SEQ_PORT_SYSTEM_ANNOUNCE)
+            continue;
+
+        switch (ev->type) {
+        case SNDRV_SEQ_EVENT_CLIENT_START:
+            apply_client(self, priv, ev->data.addr.client, TRUE);
+            break;
+        case SNDRV_SEQ_EVENT_CLIENT_CHANGE:
+            apply_client(self, priv, ev->data.addr.client, FALSE);
+            break;
+        case SNDRV_SEQ_EVENT_CLIENT_EXIT:
+            remove_client(self, priv, ev->data.addr.client);
+            break;
+        case SNDRV_SEQ_EVENT_PORT_START:
+            apply_port(self, priv, &ev->data.addr, TRUE);
+            break;
+        case SNDRV_SEQ_EVENT_PORT_CHANGE:
+            apply_port(self, priv, &ev->data.addr, FALSE);
+            break;
+        case SNDRV_SEQ_EVENT_PORT_EXIT:
+            remove_port(self, priv, &ev->data.addr);
+            break;
+        case SNDRV_SEQ_EVENT_PORT_SUBSCRIBED:
+            apply_subscription(self, priv, &ev->data.connect, TRUE);
+            break;
+        case SNDRV_SEQ_EVENT_PORT_UNSUBSCRIBED:
+            apply_subscription(self, priv, &ev->data.connect, FALSE);
+            break;
+        default:
+            break;
+        }
+
+        // The graph can be detached in any handler of signal.
+        if (priv->client == NULL)
+            break;
+    }
+}
+
+/**
+ * alsaseq_live_graph_get_snapshot:
+ * @self: A [class@LiveGraph].
+ * @snapshot: (out)(transfer none): The snapshot of graph maintained by the instance.
+ *
+ * Get the snapshot of graph maintained by the instance. The snapshot is updated by the events
+ * from the system announce port, thus it should be copied when it is used later.
+ *
+ * Returns: %TRUE when the graph is attached to the client, else %FALSE.
+ *
+ * Since: 0.4.
+ */
+gboolean alsaseq_live_graph_get_snapshot(ALSASeqLiveGraph *self,
+                                         const ALSASeqGraphSnapshot **snapshot)
+{
+    ALSASeqLiveGraphPrivate *priv;
+
+    g_return_val_if_fail(ALSASEQ_IS_LIVE_GRAPH(self), FALSE);
+    priv = alsaseq_live_graph_get_instance_private(self);
+
+    g_return_val_if_fail(snapshot != NULL, FALSE);
+
+    if (priv->snapshot == NULL)
+        return FALSE;
+
+    *snapshot = priv->snapshot;
+
+    return TRUE;
+}
@@ -0,0 +1,71 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+#ifndef __ALSA_GOBJECT_ALSASEQ_LIVE_GRAPH_H__
+#define __ALSA_GOBJECT_ALSASEQ_LIVE_GRAPH_H__
+
+#include <alsaseq.h>
+
+G_BEGIN_DECLS
+
+#define ALSASEQ_TYPE_LIVE_GRAPH     (alsaseq_live_graph_get_type())
+
+G_DECLARE_DERIVABLE_TYPE(ALSASeqLiveGraph, alsaseq_live_graph, ALSASEQ, LIVE_GRAPH, GObject);
+
+struct _ALSASeqLiveGraphClass {
+    GObjectClass parent_class;
+
+    /**
+     * ALSASeqLiveGraphClass::client_changed:
+     * @self: A [class@LiveGraph].
+     * @client_id: The numeric ID of client.
+     * @change_type: The type of change, one of [enum@GraphChangeType].
+     *
+     * Class closure for the [signal@LiveGraph::client-changed] signal.
+     *
+     * Since: 0.4.
+     */
+    void (*client_changed)(ALSASeqLiveGraph *self, guint8 client_id,
+                           ALSASeqGraphChangeType change_type);
+
+    /**
+     * ALSASeqLiveGraphClass::port_changed:
+     * @self: A [class@LiveGraph].
+     * @client_id: The numeric ID of client.
+     * @port_id: The numeric ID of port.
+     * @change_type: The type of change, one of [enum@GraphChangeType].
+     *
+     * Class closure for the [signal@LiveGraph::port-changed] signal.
+     *
+     * Since: 0.4.
+     */
+    void (*port_changed)(ALSASeqLiveGraph *self, guint8 client_id, guint8 port_id,
+                         ALSASeqGraphChangeType change_type);
+
+    /**
+     * ALSASeqLiveGraphClass::subscription_changed:
+     * @self: A [class@LiveGraph].
+     * @sender: The address of sender.
+     * @dest: The address of destination.
+     * @change_type: The type of change, one of [enum@GraphChangeType].
+     *
+     * Class closure for the [signal@LiveGraph::subscription-changed] signal.
+     *
+     * Since: 0.4.
+     */
+    void (*subscription_changed)(ALSASeqLiveGraph *self, const ALSASeqAddr *sender,
+                                 const ALSASeqAddr *dest, ALSASeqGraphChangeType change_type);
+};
+
+ALSASeqLiveGraph *alsaseq_live_graph_new();
+
+gboolean alsaseq_live_graph_attach(ALSASeqLiveGraph *self, ALSASeqUserClient *client,
+                                   guint8 port_id, GError **error);
+void alsaseq_live_graph_detach(ALSASeqLiveGraph *self);
+
+void alsaseq_live_graph_apply_event_cntr(ALSASeqLiveGraph *self, const ALSASeqEventCntr *ev_cntr);
+
+gboolean alsaseq_live_graph_get_snapshot(ALSASeqLiveGraph *self,
+                                         const ALSASeqGraphSnapshot **snapshot);
+
+G_END_DECLS
+
+#endif
@@ -36,11 +36,74 @@ void seq_queue_timer_alsa_refer_private(ALSASeqQueueTimerAlsa *self,
 void seq_remove_filter_refer_private(ALSASeqRemoveFilter *self,
                                      struct snd_seq_remove_events **data);
 
+gboolean seq_user_client_get_subscription(ALSASeqUserClient *self,
+                                          struct snd_seq_port_subscribe *data);
+
 void seq_event_cntr_serialize(ALSASeqEventCntr *self, const GList *events, gboolean aligned);
+void seq_event_cntr_reserve(ALSASeqEventCntr *self, gsize length);
+void seq_event_iter_init(ALSASeqEventCntrIter *iter, guint8 *buf, gsize length, gboolean aligned);
+struct snd_seq_event *seq_event_iter_next(ALSASeqEventCntrIter *iter);
 void seq_event_copy_flattened(const ALSASeqEvent *self, guint8 *buf, gsize length);
 gsize seq_event_calculate_flattened_length(const ALSASeqEvent *self, gboolean aligned);
+gboolean seq_event_is_flattened(const ALSASeqEvent *self);
 gboolean seq_event_is_deliverable(const ALSASeqEvent *self);
 
+gboolean seq_query_system_info(int fd, ALSASeqSystemInfo **system_info, GError **error);
+gboolean seq_query_client_id_list(int fd, gboolean exclude_self, guint8 **entries,
+                                  gsize *entry_count, GError **error);
+gboolean seq_query_client_info(int fd, guint8 client_id, ALSASeqClientInfo **client_info,
+                               GError **error);
+gboolean seq_query_port_id_list(int fd, guint8 client_id, guint8 **entries, gsize *entry_count,
+                                GError **error);
+gboolean seq_query_port_info(int fd, guint8 client_id, guint8 port_id,
+                             ALSASeqPortInfo **port_info, GError **error);
+gboolean seq_query_client_pool(int fd, guint8 client_id, ALSASeqClientPool **client_pool,
+                               GError **error);
+gboolean seq_query_subscription_list(int fd, const ALSASeqAddr *addr,
+                                     ALSASeqQuerySubscribeType query_type, GList **entries,
+                                     GError **error);
+gboolean seq_query_queue_id_list(int fd, guint8 **entries, gsize *entry_count, GError **error);
+gboolean seq_query_queue_info_by_id(int fd, guint8 queue_id, ALSASeqQueueInfo **queue_info,
+                                    GError **error);
+gboolean seq_query_queue_info_by_name(int fd, const gchar *name, ALSASeqQueueInfo **queue_info,
+                                      GError **error);
+gboolean seq_query_queue_status(int fd, guint8 queue_id, ALSASeqQueueStatus *queue_status,
+                                GError **error);
+gboolean seq_query_graph_snapshot(int fd, gboolean exclude_self, ALSASeqGraphSnapshot **snapshot,
+                                  GError **error);
+
+ALSASeqGraphSnapshot *seq_graph_snapshot_new();
+void seq_graph_snapshot_free(ALSASeqGraphSnapshot *self);
+gboolean seq_graph_snapshot_update_client(ALSASeqGraphSnapshot *self,
+                                          const struct snd_seq_client_info *info);
+gboolean seq_graph_snapshot_update_port(ALSASeqGraphSnapshot *self,
+                                        const struct snd_seq_port_info *info);
+gboolean seq_graph_snapshot_add_subscription(ALSASeqGraphSnapshot *self,
+                                             const struct snd_seq_addr *sender,
+                                             const struct snd_seq_addr *dest, unsigned char queue,
+                                             unsigned int flags);
+gboolean seq_graph_snapshot_remove_client(ALSASeqGraphSnapshot *self, guint8 client_id);
+gboolean seq_graph_snapshot_remove_port(ALSASeqGraphSnapshot *self, guint8 client_id,
+                                        guint8 port_id);
+gboolean seq_graph_snapshot_remove_subscription(ALSASeqGraphSnapshot *self,
+                                                const struct snd_seq_addr *sender,
+                                                const struct snd_seq_addr *dest);
+gboolean seq_graph_snapshot_find_client_port(const ALSASeqGraphSnapshot *self, guint8 client_id,
+                                             guint8 *port_id);
+gboolean seq_graph_snapshot_find_port_subscription(const ALSASeqGraphSnapshot *self,
+                                                   const struct snd_seq_addr *addr,
+                                                   struct snd_seq_addr *sender,
+                                                   struct snd_seq_addr *dest);
+
+struct seq_event_ring;
+
+struct seq_event_ring *seq_event_ring_new(guint size);
+void seq_event_ring_free(struct seq_event_ring *ring);
+gboolean seq_event_ring_push(struct seq_event_ring *ring, const guint8 *buf, gsize length);
+gboolean seq_event_ring_pop(struct seq_event_ring *ring, ALSASeqEventCntr *cntr);
+guint seq_event_ring_get_overrun_count(struct seq_event_ring *ring);
+guint seq_event_ring_get_high_watermark(struct seq_event_ring *ring);
+
 #define QUEUE_ID_PROP_NAME          "queue-id"
 #define TIMER_TYPE_PROP_NAME        "timer-type"
 
@@ -83,6 +83,440 @@ static gboolean open_fd(int *fd, GError **error)
     return result;
 }
 
+
+// NOTE: The helper functions below are shared by the functions in this file, which open and close
+// the file descriptor per call, and the methods of ALSASeqUserClient, which reuse the file
+// descriptor opened by the instance.
+
+gboolean seq_query_system_info(int fd, ALSASeqSystemInfo **system_info, GError **error)
+{
+    struct snd_seq_system_info *info;
+
+    *system_info = g_object_new(ALSASEQ_TYPE_SYSTEM_INFO, NULL);
+    seq_system_info_refer_private(*system_info, &info);
+
+    if (ioctl(fd, SNDRV_SEQ_IOCTL_SYSTEM_INFO, info) < 0) {
+        generate_file_error(error, errno, "ioctl(SYSTEM_INFO)");
+        g_object_unref(*system_info);
+        *system_info = NULL;
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+gboolean seq_query_client_id_list(int fd, gboolean exclude_self, guint8 **entries,
+                                  gsize *entry_count, GError **error)
+{
+    int my_id;
+    struct snd_seq_system_info system_info = {0};
+    unsigned int count;
+    guint8 *list;
+    unsigned int index;
+    struct snd_seq_client_info client_info = {0};
+    gboolean result;
+
+    if (ioctl(fd, SNDRV_SEQ_IOCTL_CLIENT_ID, &my_id) < 0) {
+        generate_file_error(error, errno, "ioctl(CLIENT_ID)");
+        return FALSE;
+    }
+
+    if (ioctl(fd, SNDRV_SEQ_IOCTL_SYSTEM_INFO, &system_info) < 0) {
+        generate_file_error(error, errno, "ioctl(SYSTEM_INFO)");
+        return FALSE;
+    }
+
+    count = system_info.cur_clients;
+    if (exclude_self)
+        --count;
+    if (count == 0)  {
+        *entry_count = 0;
+        return TRUE;
+    }
+
+    list = g_malloc0_n(count, sizeof(guint));
+
+    index = 0;
+
+    result = TRUE;
+    client_info.client = -1;
+    while (index < count) {
+        if (ioctl(fd, SNDRV_SEQ_IOCTL_QUERY_NEXT_CLIENT, &client_info) < 0) {
+            if (errno != ENOENT) {
+                generate_file_error(error, errno, "ioctl(QUERY_NEXT_CLIENT)");
+                result = FALSE;
+            }
+            break;
+        }
+
+        if (!exclude_self || client_info.client != my_id) {
+            list[index] = client_info.client;
+            ++index;
+        }
+    }
+
+    if (!result) {
+        g_free(list);
+        return FALSE;
+    }
+
+    g_warn_if_fail(index == count);
+
+    *entries = list;
+    *entry_count = count;
+
+    return TRUE;
+}
+
+gboolean seq_query_client_info(int fd, guint8 client_id, ALSASeqClientInfo **client_info,
+                               GError **error)
+{
+    struct snd_seq_client_info *info;
+
+    *client_info = g_object_new(ALSASEQ_TYPE_CLIENT_INFO, NULL);
+    seq_client_info_refer_private(*client_info, &info);
+
+    info->client = client_id;
+    if (ioctl(fd, SNDRV_SEQ_IOCTL_GET_CLIENT_INFO, info) < 0) {
+        generate_file_error(error, errno, "ioctl(GET_CLIENT_INFO)");
+        g_object_unref(*client_info);
+        *client_info = NULL;
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+gboolean seq_query_port_id_list(int fd, guint8 client_id, guint8 **entries, gsize *entry_count,
+                                GError **error)
+{
+    struct snd_seq_client_info client_info = {0};
+    unsigned int count;
+    guint8 *list;
+    unsigned int index;
+    struct snd_seq_port_info port_info = {0};
+    gboolean result;
+
+    client_info.client = client_id;
+    if (ioctl(fd, SNDRV_SEQ_IOCTL_GET_CLIENT_INFO, &client_info) < 0) {
+        generate_file_error(error, errno, "ioctl(GET_CLIENT_INFO)");
+        return FALSE;
+    }
+
+    count = client_info.num_ports;
+    list = g_malloc0_n(count, sizeof(*list));
+
+    index = 0;
+
+    result = TRUE;
+    port_info.addr.client = client_id;
+    port_info.addr.port = -1;
+    while (index < count) {
+        if (ioctl(fd, SNDRV_SEQ_IOCTL_QUERY_NEXT_PORT, &port_info) < 0) {
+            if (errno != ENOENT) {
+                generate_file_error(error, errno, "ioctl(QUERY_NEXT_PORT)");
+                result = FALSE;
+            }
+            break;
+        }
+
+        list[index] = port_info.addr.port;
+        ++index;
+    }
+
+    if (!result) {
+        g_free(list);
+        return FALSE;
+    }
+
+    g_warn_if_fail(index == count);
+
+    *entries = list;
+    *entry_count = count;
+
+    return TRUE;
+}
+
+gboolean seq_query_port_info(int fd, guint8 client_id, guint8 port_id,
+                             ALSASeqPortInfo **port_info, GError **error)
+{
+    struct snd_seq_port_info *info;
+
+    *port_info = g_object_new(ALSASEQ_TYPE_PORT_INFO, NULL);
+    seq_port_info_refer_private(*port_info, &info);
+
+    info->addr.client = client_id;
+    info->addr.port = port_id;
+    if (ioctl(fd, SNDRV_SEQ_IOCTL_GET_PORT_INFO, info) < 0) {
+        generate_file_error(error, errno, "ioctl(GET_PORT_INFO)");
+        g_object_unref(*port_info);
+        *port_info = NULL;
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+gboolean seq_query_client_pool(int fd, guint8 client_id, ALSASeqClientPool **client_pool,
+                               GError **error)
+{
+    struct snd_seq_client_pool *pool;
+
+    *client_pool = g_object_new(ALSASEQ_TYPE_CLIENT_POOL, NULL);
+    seq_client_pool_refer_private(*client_pool, &pool);
+
+    pool->client = client_id;
+    if (ioctl(fd, SNDRV_SEQ_IOCTL_GET_CLIENT_POOL, pool) < 0) {
+        generate_file_error(error, errno, "ioctl(GET_CLIENT_POOL)");
+        g_object_unref(*client_pool);
+        *client_pool = NULL;
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+static void fill_data_with_result(struct snd_seq_port_subscribe *data,
+                                  struct snd_seq_query_subs *query)
+{
+    if (query->type == SNDRV_SEQ_QUERY_SUBS_READ) {
+        data->sender = query->root;
+        data->dest = query->addr;
+    } else {
+        data->sender = query->addr;
+        data->dest = query->root;
+    }
+    data->queue = query->queue;
+    data->flags = query->flags;
+}
+
+gboolean seq_query_subscription_list(int fd, const ALSASeqAddr *addr,
+                                     ALSASeqQuerySubscribeType query_type, GList **entries,
+                                     GError **error)
+{
+    struct snd_seq_query_subs query = {0};
+    unsigned int count;
+    unsigned int index;
+    GList *head = NULL;
+    gboolean result;
+
+    query.root = *addr;
+    query.type = query_type;
+    // NOTE: ALSA Sequencer core returns ENOENT when no subscription is at the index.
+    if (ioctl(fd, SNDRV_SEQ_IOCTL_QUERY_SUBS, &query) < 0) {
+        if (errno == ENOENT)
+            return TRUE;
+        generate_file_error(error, errno, "ioctl(QUERY_SUBS)");
+        return FALSE;
+    }
+    count = query.num_subs;
+
+    result = TRUE;
+    index = 0;
+    while (index < count) {
+        ALSASeqSubscribeData *subs_data = g_object_new(ALSASEQ_TYPE_SUBSCRIBE_DATA, NULL);
+        struct snd_seq_port_subscribe *data;
+
+        seq_subscribe_data_refer_private(subs_data, &data);
+        fill_data_with_result(data, &query);
+
+        head = g_list_prepend(head, (gpointer)subs_data);
+        ++index;
+
+        // The last entry is already retrieved.
+        if (index >= count)
+            break;
+
+        ++query.index;
+        if (ioctl(fd, SNDRV_SEQ_IOCTL_QUERY_SUBS, &query) < 0) {
+            // The subscription is removed while walking, thus the retrieved entries are the list.
+            if (errno == ENOENT)
+                break;
+            generate_file_error(error, errno, "ioctl(QUERY_SUBS)");
+            result = FALSE;
+            break;
+        }
+    }
+
+    if (!result) {
+        g_list_free_full(head, g_object_unref);
+        return FALSE;
+    }
+
+    // NOTE: Prepend entries and reverse them at last to avoid traversing the list for each entry.
+    *entries = g_list_concat(*entries, g_list_reverse(head));
+
+    return TRUE;
+}
+
+gboolean seq_query_queue_id_list(int fd, guint8 **entries, gsize *entry_count, GError **error)
+{
+    struct snd_seq_system_info info = {0};
+    unsigned int maximum_count;
+    unsigned int count;
+    guint8 *list;
+    unsigned int index;
+    int i;
+
+    if (ioctl(fd, SNDRV_SEQ_IOCTL_SYSTEM_INFO, &info) < 0) {
+        generate_file_error(error, errno, "ioctl(SYSTEM_INFO)");
+        return FALSE;
+    }
+    maximum_count = info.queues;
+    count = info.cur_queues;
+
+    if (count == 0) {
+        *entry_count = 0;
+        return TRUE;
+    }
+
+    list = g_malloc0_n(count, sizeof(*list));
+
+    index = 0;
+    for (i = 0; i < maximum_count; ++i) {
+        struct snd_seq_queue_info info;
+
+        info.queue = i;
+        if (ioctl(fd, SNDRV_SEQ_IOCTL_GET_QUEUE_INFO, &info) < 0)
+            continue;
+
+        list[index] = i;
+        if (++index >= count)
+            break;
+    }
+
+    g_warn_if_fail(index == count);
+
+    *entries = list;
+    *entry_count = count;
+
+    return TRUE;
+}
+
+gboolean seq_query_queue_info_by_id(int fd, guint8 queue_id, ALSASeqQueueInfo **queue_info,
+                                    GError **error)
+{
+    struct snd_seq_queue_info *info;
+
+    *queue_info = g_object_new(ALSASEQ_TYPE_QUEUE_INFO, NULL);
+    seq_queue_info_refer_private(*queue_info, &info);
+
+    info->queue = queue_id;
+    if (ioctl(fd, SNDRV_SEQ_IOCTL_GET_QUEUE_INFO, info) < 0) {
+        generate_file_error(error, errno, "ioctl(GET_QUEUE_INFO)");
+        g_object_unref(*queue_info);
+        *queue_info = NULL;
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+gboolean seq_query_queue_info_by_name(int fd, const gchar *name, ALSASeqQueueInfo **queue_info,
+                                      GError **error)
+{
+    struct snd_seq_queue_info *info;
+
+    *queue_info = g_object_new(ALSASEQ_TYPE_QUEUE_INFO, NULL);
+    seq_queue_info_refer_private(*queue_info, &info);
+
+    g_strlcpy(info->name, name, sizeof(info->name));
+    if (ioctl(fd, SNDRV_SEQ_IOCTL_GET_NAMED_QUEUE, info) < 0) {
+        generate_file_error(error, errno, "ioctl(GET_NAMED_QUEUE)");
+        g_object_unref(*queue_info);
+        *queue_info = NULL;
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+gboolean seq_query_queue_status(int fd, guint8 queue_id, ALSASeqQueueStatus *queue_status,
+                                GError **error)
+{
+    struct snd_seq_queue_status *status;
+
+    seq_queue_status_refer_private(queue_status, &status);
+
+    status->queue = (int)queue_id;
+    if (ioctl(fd, SNDRV_SEQ_IOCTL_GET_QUEUE_STATUS, status) < 0) {
+        generate_file_error(error, errno, "ioctl(GET_QUEUE_STATUS)");
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+gboolean seq_query_graph_snapshot(int fd, gboolean exclude_self, ALSASeqGraphSnapshot **snapshot,
+                                  GError **error)
+{
+    int my_id;
+    struct snd_seq_client_info client_info = {0};
+
+    if (ioctl(fd, SNDRV_SEQ_IOCTL_CLIENT_ID, &my_id) < 0) {
+        generate_file_error(error, errno, "ioctl(CLIENT_ID)");
+        return FALSE;
+    }
+
+    *snapshot = seq_graph_snapshot_new();
+
+    client_info.client = -1;
+    while (TRUE) {
+        struct snd_seq_port_info port_info = {0};
+
+        if (ioctl(fd, SNDRV_SEQ_IOCTL_QUERY_NEXT_CLIENT, &client_info) < 0) {
+            if (errno == ENOENT)
+                break;
+            generate_file_error(error, errno, "ioctl(QUERY_NEXT_CLIENT)");
+            goto error;
+        }
+
+        if (exclude_self && client_info.client == my_id)
+            continue;
+
+        seq_graph_snapshot_update_client(*snapshot, &client_info);
+
+        port_info.addr.client = client_info.client;
+        port_info.addr.port = -1;
+        while (TRUE) {
+            struct snd_seq_query_subs query = {0};
+
+            if (ioctl(fd, SNDRV_SEQ_IOCTL_QUERY_NEXT_PORT, &port_info) < 0) {
+                if (errno == ENOENT)
+                    break;
+                generate_file_error(error, errno, "ioctl(QUERY_NEXT_PORT)");
+                goto error;
+            }
+
+            seq_graph_snapshot_update_port(*snapshot, &port_info);
+
+            // Each subscription is found once by query for the subscribers to read from the port.
+            query.root = port_info.addr;
+            query.type = SNDRV_SEQ_QUERY_SUBS_READ;
+            while (TRUE) {
+                if (ioctl(fd, SNDRV_SEQ_IOCTL_QUERY_SUBS, &query) < 0) {
+                    if (errno == ENOENT)
+                        break;
+                    generate_file_error(error, errno, "ioctl(QUERY_SUBS)");
+                    goto error;
+                }
+
+                seq_graph_snapshot_add_subscription(*snapshot, &query.root, &query.addr,
+                                                    query.queue, query.flags);
+
+                if (++query.index >= query.num_subs)
+                    break;
+            }
+        }
+    }
+
+    return TRUE;
+error:
+    seq_graph_snapshot_free(*snapshot);
+    *snapshot = NULL;
+    return FALSE;
+}
+
 /**
  * alsaseq_get_system_info:
  * @system_info: (out): The information of ALSA Sequencer.
@@ -107,22 +541,13 @@ gboolean alsaseq_get_system_info(ALSASeqSystemInfo **system_info, GError **error
     if (!open_fd(&fd, error))
         return FALSE;
 
-    *system_info = g_object_new(ALSASEQ_TYPE_SYSTEM_INFO, NULL);
-    seq_system_info_refer_private(*system_info, &info);
-
-    if (ioctl(fd, SNDRV_SEQ_IOCTL_SYSTEM_INFO, info) < 0) {
-        generate_file_error(error, errno, "ioctl(SYSTEM_INFO)");
-        g_object_unref(*system_info);
-        *system_info = NULL;
-        result = FALSE;
-        goto end;
+    result = seq_query_system_info(fd, system_info, error);
+    if (result) {
+        // Decrement count for the above connection.
+        seq_system_info_refer_private(*system_info, &info);
+        --info->cur_clients;
     }
 
-    // Decrement count for the above connection.
-    --info->cur_clients;
-
-    result = TRUE;
-end:
     close(fd);
     return result;
 }
@@ -140,17 +565,11 @@ end:
  * The call of function executes `open(2)``, ``close(2)``, and ``ioctl(2)`` system calls with
  * `SNDRV_SEQ_IOCTL_CLIENT_ID`, `SNDRV_SEQ_IOCTL_SYSTEM_INFO`, and
  * `SNDRV_SEQ_IOCTL_QUERY_NEXT_CLIENT` command for ALSA sequencer character device.
- *
- * Returns: %TRUE when the overall operation finishes successfully, else %FALSE.
- */
-gboolean alsaseq_get_client_id_list(guint8 **entries, gsize *entry_count, GError **error)
-{
-    int my_id;
-    struct snd_seq_system_info system_info = {0};
-    unsigned int count;
-    guint8 *list;
-    unsigned int index;
-    struct snd_seq_client_info client_info = {0};
+ *
+ * Returns: %TRUE when the overall operation finishes successfully, else %FALSE.
+ */
+gboolean alsaseq_get_client_id_list(guint8 **entries, gsize *entry_count, GError **error)
+{
     int fd;
     gboolean result;
 
@@ -161,57 +580,9 @@ gboolean alsaseq_get_client_id_list(guint8 **entries, gsize *entry_count, GError
     if (!open_fd(&fd, error))
         return FALSE;
 
-    if (ioctl(fd, SNDRV_SEQ_IOCTL_CLIENT_ID, &my_id) < 0) {
-        generate_file_error(error, errno, "ioctl(CLIENT_ID)");
-        result = FALSE;
-        goto end;
-    }
-
-    if (ioctl(fd, SNDRV_SEQ_IOCTL_SYSTEM_INFO, &system_info) < 0) {
-        generate_file_error(error, errno, "ioctl(SYSTEM_INFO)");
-        result = FALSE;
-        goto end;
-    }
-
     // Exclude myself.
-    count = system_info.cur_clients - 1;
-    if (count == 0)  {
-        *entry_count = 0;
-        result = TRUE;
-        goto end;
-    }
-
-    list = g_malloc0_n(count, sizeof(guint));
-
-    index = 0;
-
-    result = TRUE;
-    client_info.client = -1;
-    while (index < count) {
-        if (ioctl(fd, SNDRV_SEQ_IOCTL_QUERY_NEXT_CLIENT, &client_info) < 0) {
-            if (errno != ENOENT) {
-                generate_file_error(error, errno, "ioctl(QUERY_NEXT_CLIENT)");
-                result = FALSE;
-            }
-            break;
-        }
-
-        if (client_info.client != my_id) {
-            list[index] = client_info.client;
-            ++index;
-        }
-    }
-
-    if (!result) {
-        g_free(list);
-        goto end;
-    }
-
-    g_warn_if_fail(index == count);
+    result = seq_query_client_id_list(fd, TRUE, entries, entry_count, error);
 
-    *entries = list;
-    *entry_count = count;
-end:
     close(fd);
     return result;
 }
@@ -232,7 +603,6 @@ end:
  */
 gboolean alsaseq_get_client_info(guint8 client_id, ALSASeqClientInfo **client_info, GError **error)
 {
-    struct snd_seq_client_info *info;
     int fd;
     gboolean result;
 
@@ -242,18 +612,7 @@ gboolean alsaseq_get_client_info(guint8 client_id, ALSASeqClientInfo **client_in
     if (!open_fd(&fd, error))
         return FALSE;
 
-    *client_info = g_object_new(ALSASEQ_TYPE_CLIENT_INFO, NULL);
-    seq_client_info_refer_private(*client_info, &info);
-
-    info->client = client_id;
-    if (ioctl(fd, SNDRV_SEQ_IOCTL_GET_CLIENT_INFO, info) < 0) {
-        generate_file_error(error, errno, "ioctl(GET_CLIENT_INFO)");
-        g_object_unref(*client_info);
-        *client_info = NULL;
-        result = FALSE;
-    } else {
-        result = TRUE;
-    }
+    result = seq_query_client_info(fd, client_id, client_info, error);
 
     close(fd);
 
@@ -278,11 +637,6 @@ gboolean alsaseq_get_client_info(guint8 client_id, ALSASeqClientInfo **client_in
 gboolean alsaseq_get_port_id_list(guint8 client_id, guint8 **entries, gsize *entry_count,
                                   GError **error)
 {
-    struct snd_seq_client_info client_info = {0};
-    unsigned int count;
-    guint8 *list;
-    unsigned int index;
-    struct snd_seq_port_info port_info = {0};
     int fd;
     gboolean result;
 
@@ -293,45 +647,8 @@ gboolean alsaseq_get_port_id_list(guint8 client_id, guint8 **entries, gsize *ent
     if (!open_fd(&fd, error))
         return FALSE;
 
-    client_info.client = client_id;
-    if (ioctl(fd, SNDRV_SEQ_IOCTL_GET_CLIENT_INFO, &client_info) < 0) {
-        generate_file_error(error, errno, "ioctl(GET_CLIENT_INFO)");
-        result = FALSE;
-        goto end;
-    }
-
-    count = client_info.num_ports;
-    list = g_malloc0_n(count, sizeof(*list));
-
-    index = 0;
-
-    result = TRUE;
-    port_info.addr.client = client_id;
-    port_info.addr.port = -1;
-    while (index < count) {
-        if (ioctl(fd, SNDRV_SEQ_IOCTL_QUERY_NEXT_PORT, &port_info) < 0) {
-            if (errno != ENOENT) {
-                generate_file_error(error, errno, "ioctl(QUERY_NEXT_PORT)");
-                result = FALSE;
-            }
-            break;
-        }
-
-        list[index] = port_info.addr.port;
-        ++index;
-    }
-    close(fd);
-
-    if (!result) {
-        g_free(list);
-        goto end;
-    }
-
-    g_warn_if_fail(index == count);
+    result = seq_query_port_id_list(fd, client_id, entries, entry_count, error);
 
-    *entries = list;
-    *entry_count = count;
-end:
     close(fd);
     return result;
 }
@@ -355,7 +672,6 @@ end:
 gboolean alsaseq_get_port_info(guint8 client_id, guint8 port_id, ALSASeqPortInfo **port_info,
                                GError **error)
 {
-    struct snd_seq_port_info *info;
     int fd;
     gboolean result;
 
@@ -365,19 +681,7 @@ gboolean alsaseq_get_port_info(guint8 client_id, guint8 port_id, ALSASeqPortInfo
     if (!open_fd(&fd, error))
         return FALSE;
 
-    *port_info = g_object_new(ALSASEQ_TYPE_PORT_INFO, NULL);
-    seq_port_info_refer_private(*port_info, &info);
-
-    info->addr.client = client_id;
-    info->addr.port = port_id;
-    if (ioctl(fd, SNDRV_SEQ_IOCTL_GET_PORT_INFO, info) < 0) {
-        generate_file_error(error, errno, "ioctl(GET_PORT_INFO)");
-        g_object_unref(*port_info);
-        *port_info = NULL;
-        result = FALSE;
-    } else {
-        result = TRUE;
-    }
+    result = seq_query_port_info(fd, client_id, port_id, port_info, error);
 
     close(fd);
 
@@ -401,7 +705,6 @@ gboolean alsaseq_get_port_info(guint8 client_id, guint8 port_id, ALSASeqPortInfo
 gboolean alsaseq_get_client_pool(guint8 client_id, ALSASeqClientPool **client_pool, GError **error)
 {
     int fd;
-    struct snd_seq_client_pool *pool;
     gboolean result;
 
     g_return_val_if_fail(client_pool != NULL, FALSE);
@@ -410,37 +713,13 @@ gboolean alsaseq_get_client_pool(guint8 client_id, ALSASeqClientPool **client_po
     if (!open_fd(&fd, error))
         return FALSE;
 
-    *client_pool = g_object_new(ALSASEQ_TYPE_CLIENT_POOL, NULL);
-    seq_client_pool_refer_private(*client_pool, &pool);
-
-    pool->client = client_id;
-    if (ioctl(fd, SNDRV_SEQ_IOCTL_GET_CLIENT_POOL, pool) < 0) {
-        generate_file_error(error, errno, "ioctl(GET_CLIENT_POOL)");
-        g_object_unref(*client_pool);
-        result = FALSE;
-    } else {
-        result = TRUE;
-    }
+    result = seq_query_client_pool(fd, client_id, client_pool, error);
 
     close(fd);
 
     return result;
 }
 
-static void fill_data_with_result(struct snd_seq_port_subscribe *data,
-                                  struct snd_seq_query_subs *query)
-{
-    if (query->type == SNDRV_SEQ_QUERY_SUBS_READ) {
-        data->sender = query->root;
-        data->dest = query->addr;
-    } else {
-        data->sender = query->addr;
-        data->dest = query->root;
-    }
-    data->queue = query->queue;
-    data->flags = query->flags;
-}
-
 /**
  * alsaseq_get_subscription_list:
  * @addr: A [struct@Addr] to query.
@@ -451,6 +730,8 @@ static void fill_data_with_result(struct snd_seq_port_subscribe *data,
  *
  * Get the list of subscription for given address and query type.
  *
+ * The list is empty when the address has no subscription.
+ *
  * The call of function executes `open(2)`, `close(2)`, and `ioctl(2)` system calls with
  * `SNDRV_SEQ_IOCTL_QUERY_SUBS` command for ALSA sequencer character device.
  *
@@ -461,9 +742,6 @@ gboolean alsaseq_get_subscription_list(const ALSASeqAddr *addr,
                                        GError **error)
 {
     int fd;
-    struct snd_seq_query_subs query = {0};
-    unsigned int count;
-    unsigned int index;
     gboolean result;
 
     g_return_val_if_fail(entries != NULL, FALSE);
@@ -472,44 +750,8 @@ gboolean alsaseq_get_subscription_list(const ALSASeqAddr *addr,
     if (!open_fd(&fd, error))
         return FALSE;
 
-    g_object_get((gpointer)addr, "client-id", &query.root.client,
-                 "port-id", &query.root.port, NULL);
-    query.type = query_type;
-    if (ioctl(fd, SNDRV_SEQ_IOCTL_QUERY_SUBS, &query) < 0) {
-        if (errno != ENOENT)
-            generate_file_error(error, errno, "ioctl(QUERY_SUBS)");
-        result = FALSE;
-        goto end;
-    }
-    count = query.num_subs;
-
-    index = 0;
-    while (index < count) {
-        ALSASeqSubscribeData *subs_data = g_object_new(ALSASEQ_TYPE_SUBSCRIBE_DATA, NULL);
-        struct snd_seq_port_subscribe *data;
-
-        seq_subscribe_data_refer_private(subs_data, &data);
-        fill_data_with_result(data, &query);
-
-        *entries = g_list_append(*entries, (gpointer)subs_data);
-        ++index;
-
-        ++query.index;
-        if (ioctl(fd, SNDRV_SEQ_IOCTL_QUERY_SUBS, &query) < 0) {
-            if (errno != ENOENT)
-                generate_file_error(error, errno, "ioctl(QUERY_SUBS)");
-            result = FALSE;
-            break;
-        }
-    }
-
-    if (!result) {
-        g_list_free_full(*entries, g_object_unref);
-        goto end;
-    }
+    result = seq_query_subscription_list(fd, addr, query_type, entries, error);
 
-    g_warn_if_fail(index == count);
-end:
     close(fd);
     return result;
 }
@@ -531,13 +773,7 @@ end:
 gboolean alsaseq_get_queue_id_list(guint8 **entries, gsize *entry_count, GError **error)
 {
     int fd;
-    struct snd_seq_system_info info = {0};
-    unsigned int maximum_count;
-    unsigned int count;
-    guint8 *list;
-    unsigned int index;
     gboolean result;
-    int i;
 
     g_return_val_if_fail(entries != NULL, FALSE);
     g_return_val_if_fail(entry_count != NULL, FALSE);
@@ -546,41 +782,8 @@ gboolean alsaseq_get_queue_id_list(guint8 **entries, gsize *entry_count, GError
     if (!open_fd(&fd, error))
         return FALSE;
 
-    if (ioctl(fd, SNDRV_SEQ_IOCTL_SYSTEM_INFO, &info) < 0) {
-        generate_file_error(error, errno, "ioctl(SYSTEM_INFO)");
-        result = FALSE;
-        goto end;
-    }
-    maximum_count = info.queues;
-    count = info.cur_queues;
-
-    if (count == 0) {
-        result = TRUE;
-        goto end;
-    }
-
-    list = g_malloc0_n(count, sizeof(*entries));
-
-    index = 0;
-    for (i = 0; i < maximum_count; ++i) {
-        struct snd_seq_queue_info info;
-
-        info.queue = i;
-        if (ioctl(fd, SNDRV_SEQ_IOCTL_GET_QUEUE_INFO, &info) < 0)
-            continue;
-
-        list[index] = i;
-        if (++index >= count)
-            break;
-    }
-
-    g_warn_if_fail(index == count);
-
-    *entries = list;
-    *entry_count = count;
+    result = seq_query_queue_id_list(fd, entries, entry_count, error);
 
-    result = TRUE;
-end:
     close(fd);
 
     return result;
@@ -602,7 +805,6 @@ end:
 gboolean alsaseq_get_queue_info_by_id(guint8 queue_id, ALSASeqQueueInfo **queue_info,
                                       GError **error)
 {
-    struct snd_seq_queue_info *info;
     int fd;
     gboolean result;
 
@@ -612,17 +814,7 @@ gboolean alsaseq_get_queue_info_by_id(guint8 queue_id, ALSASeqQueueInfo **queue_
     if (!open_fd(&fd, error))
         return FALSE;
 
-    *queue_info = g_object_new(ALSASEQ_TYPE_QUEUE_INFO, NULL);
-    seq_queue_info_refer_private(*queue_info, &info);
-
-    info->queue = queue_id;
-    if (ioctl(fd, SNDRV_SEQ_IOCTL_GET_QUEUE_INFO, info) < 0) {
-        generate_file_error(error, errno, "ioctl(GET_QUEUE_INFO)");
-        g_object_unref(*queue_info);
-        result = FALSE;
-    } else {
-        result = TRUE;
-    }
+    result = seq_query_queue_info_by_id(fd, queue_id, queue_info, error);
 
     close(fd);
 
@@ -645,7 +837,6 @@ gboolean alsaseq_get_queue_info_by_id(guint8 queue_id, ALSASeqQueueInfo **queue_
 gboolean alsaseq_get_queue_info_by_name(const gchar *name, ALSASeqQueueInfo **queue_info,
                                         GError **error)
 {
-    struct snd_seq_queue_info *info;
     int fd;
     gboolean result;
 
@@ -655,17 +846,7 @@ gboolean alsaseq_get_queue_info_by_name(const gchar *name, ALSASeqQueueInfo **qu
     if (!open_fd(&fd, error))
         return FALSE;
 
-    *queue_info = g_object_new(ALSASEQ_TYPE_QUEUE_INFO, NULL);
-    seq_queue_info_refer_private(*queue_info, &info);
-
-    g_strlcpy(info->name, name, sizeof(info->name));
-    if (ioctl(fd, SNDRV_SEQ_IOCTL_GET_NAMED_QUEUE, info) < 0) {
-        generate_file_error(error, errno, "ioctl(GET_NAMED_QUEUE)");
-        g_object_unref(*queue_info);
-        result = FALSE;
-    } else {
-        result = TRUE;
-    }
+    result = seq_query_queue_info_by_name(fd, name, queue_info, error);
 
     close(fd);
 
@@ -688,26 +869,52 @@ gboolean alsaseq_get_queue_info_by_name(const gchar *name, ALSASeqQueueInfo **qu
 gboolean alsaseq_get_queue_status(guint8 queue_id, ALSASeqQueueStatus *const *queue_status,
                                   GError **error)
 {
-    struct snd_seq_queue_status *status;
     int fd;
     gboolean result;
 
     g_return_val_if_fail(queue_status != NULL, FALSE);
+    g_return_val_if_fail(ALSASEQ_IS_QUEUE_STATUS(*queue_status), FALSE);
     g_return_val_if_fail(error == NULL || *error == NULL, FALSE);
 
     if (!open_fd(&fd, error))
         return FALSE;
 
-    g_return_val_if_fail(ALSASEQ_IS_QUEUE_STATUS(*queue_status), FALSE);
-    seq_queue_status_refer_private(*queue_status, &status);
+    result = seq_query_queue_status(fd, queue_id, *queue_status, error);
 
-    status->queue = (int)queue_id;
-    if (ioctl(fd, SNDRV_SEQ_IOCTL_GET_QUEUE_STATUS, status) < 0) {
-        generate_file_error(error, errno, "ioctl(GET_QUEUE_STATUS)");
-        result = FALSE;
-    } else {
-        result = TRUE;
-    }
+    close(fd);
+
+    return result;
+}
+
+/**
+ * alsaseq_get_graph_snapshot:
+ * @snapshot: (out): The snapshot of clients, ports, and subscriptions.
+ * @error: A [struct@GLib.Error]. Error is generated with domain of `GLib.FileError`.
+ *
+ * Get the snapshot of all clients, ports, and subscriptions in ALSA Sequencer at once. The client
+ * temporarily added for the query is not included.
+ *
+ * The call of function executes `open(2)`, `close(2)`, and `ioctl(2)` system calls with
+ * `SNDRV_SEQ_IOCTL_CLIENT_ID`, `SNDRV_SEQ_IOCTL_QUERY_NEXT_CLIENT`,
+ * `SNDRV_SEQ_IOCTL_QUERY_NEXT_PORT`, and `SNDRV_SEQ_IOCTL_QUERY_SUBS` commands for ALSA sequencer
+ * character device.
+ *
+ * Returns: %TRUE when the overall operation finishes successfully, else %FALSE.
+ *
+ * Since: 0.4.
+ */
+gboolean alsaseq_get_graph_snapshot(ALSASeqGraphSnapshot **snapshot, GError **error)
+{
+    int fd;
+    gboolean result;
+
+    g_return_val_if_fail(snapshot != NULL, FALSE);
+    g_return_val_if_fail(error == NULL || *error == NULL, FALSE);
+
+    if (!open_fd(&fd, error))
+        return FALSE;
+
+    result = seq_query_graph_snapshot(fd, TRUE, snapshot, error);
 
     close(fd);
 
@@ -38,6 +38,8 @@ gboolean alsaseq_get_queue_info_by_name(const gchar *name, ALSASeqQueueInfo **qu
 gboolean alsaseq_get_queue_status(guint8 queue_id, ALSASeqQueueStatus *const *queue_status,
                                   GError **error);
 
+gboolean alsaseq_get_graph_snapshot(ALSASeqGraphSnapshot **snapshot, GError **error);
+
 G_END_DECLS
 
 #endif
@@ -8,7 +8,11 @@
 #include <fcntl.h>
 #include <unistd.h>
 #include <sys/ioctl.h>
+#include <poll.h>
+#include <sys/eventfd.h>
 #include <errno.h>
+#include <pthread.h>
+#include <sched.h>
 
 /**
  * ALSASeqUserClient:
@@ -23,12 +27,79 @@
  * [struct@GLib.MainContext] / [struct@GLib.MainLoop] is available as event dispatcher. The
  * [signal@UserClient::handle-event] signal is emitted in the event dispatcher to notify the
  * event. The call of [method@UserClient.schedule_event] schedules event with given parameters.
+ *
+ * The size of buffer for the `read(2)` system call is configured by
+ * [property@UserClient:read-buffer-size] before the call of [method@UserClient.create_source].
+ * When [property@UserClient:dispatch-budget] or [property@UserClient:dispatch-event-budget] is not
+ * zero, the source continues to read events in a dispatch till no event is available or the budget
+ * is exhausted.
+ *
+ * As an alternative of the source, the call of [method@UserClient.start_reader] starts a thread to
+ * read events. The thread passes batch of events to the ring buffer without lock, then the call of
+ * [method@UserClient.pop_events] retrieves the batch in any thread. The call of
+ * [method@UserClient.create_reader_source] returns the instance of [struct@GLib.Source] to emit
+ * the [signal@UserClient::handle-event] signal for the batch in the ring buffer.
+ *
+ * The events handled by the sources are filtered by the type of event, the address of source, and
+ * the channel of event. The filter for the type of event is also programmed to ALSA Sequencer core
+ * so that the events are not delivered to the client. The rest of filters are applied in the
+ * dispatch of the source returned by [method@UserClient.create_source], or in the thread started
+ * by [method@UserClient.start_reader] before the batch is passed to the ring buffer.
  */
+// The set of filters is not changed once published, thus it is referred to without lock.
+struct seq_event_filter {
+    gboolean by_type;
+    guint8 types[32];
+    guint8 *sources;
+    guint16 channels;
+};
+
+struct seq_reader {
+    gint ref_count;
+    guint generation;
+    GThread *thread;
+    int fd;
+    int stop_fd;
+    int notify_fd;
+    guint8 *buf;
+    gsize buf_len;
+    struct seq_event_ring *ring;
+    gint priority;
+
+    GMutex mutex;
+    GCond cond;
+    gboolean started;
+    int sched_err;
+    gint disconnected;
+    gpointer priv;
+};
+
+struct seq_event_handler {
+    gint ref_count;
+    ALSASeqUserClientEventHandler func;
+    gpointer data;
+    GDestroyNotify destroy;
+};
+
 typedef struct {
     int fd;
     const char *devnode;
     int client_id;
     guint16 proto_ver_triplet[3];
+    guint read_buffer_size;
+    guint dispatch_budget;
+    guint dispatch_event_budget;
+
+    GMutex reader_lock;
+    struct seq_reader *reader;
+    guint reader_generation;
+
+    GMutex handler_lock;
+    struct seq_event_handler *event_handler;
+
+    GMutex filter_lock;
+    struct seq_event_filter *filter;
+    gint filter_readers;
 } ALSASeqUserClientPrivate;
 G_DEFINE_TYPE_WITH_PRIVATE(ALSASeqUserClient, alsaseq_user_client, G_TYPE_OBJECT)
 
@@ -54,16 +125,35 @@ static const char *const err_msgs[] = {
         g_set_error(exception, ALSASEQ_USER_CLIENT_ERROR, ALSASEQ_USER_CLIENT_ERROR_FAILED, \
                     fmt" %d(%s)", arg, errno, strerror(errno))
 
+// The bitmap for source filter has a bit for each port of each client.
+#define SOURCE_FILTER_BITMAP_STRIDE     ((G_MAXUINT8 + 1) / 8)
+#define SOURCE_FILTER_BITMAP_SIZE       ((G_MAXUINT8 + 1) * SOURCE_FILTER_BITMAP_STRIDE)
+
 typedef struct {
     GSource src;
     ALSASeqUserClient *self;
     gpointer tag;
     void *buf;
     size_t buf_len;
+    size_t capacity;
 } UserClientSource;
 
+typedef struct {
+    GSource src;
+    ALSASeqUserClient *self;
+    gpointer tag;
+    struct seq_reader *reader;
+    ALSASeqEventCntr ev_cntr;
+} UserClientReaderSource;
+
 enum seq_user_client_prop_type {
     SEQ_USER_CLIENT_PROP_CLIENT_ID = 1,
+    SEQ_USER_CLIENT_PROP_READ_BUFFER_SIZE,
+    SEQ_USER_CLIENT_PROP_DISPATCH_BUDGET,
+    SEQ_USER_CLIENT_PROP_DISPATCH_EVENT_BUDGET,
+    SEQ_USER_CLIENT_PROP_READER_OVERRUN_COUNT,
+    SEQ_USER_CLIENT_PROP_READER_HIGH_WATERMARK,
+    SEQ_USER_CLIENT_PROP_READER_DISCONNECTED,
     SEQ_USER_CLIENT_PROP_COUNT,
 };
 static GParamSpec *seq_user_client_props[SEQ_USER_CLIENT_PROP_COUNT] = { NULL, };
@@ -74,6 +164,29 @@ enum seq_user_client_sig_type {
 };
 static guint seq_user_client_sigs[SEQ_USER_CLIENT_SIG_TYPE_COUNT] = { 0 };
 
+static void seq_user_client_set_property(GObject *obj, guint id, const GValue *val,
+                                         GParamSpec *spec)
+{
+    ALSASeqUserClient *self = ALSASEQ_USER_CLIENT(obj);
+    ALSASeqUserClientPrivate *priv =
+                                alsaseq_user_client_get_instance_private(self);
+
+    switch (id) {
+    case SEQ_USER_CLIENT_PROP_READ_BUFFER_SIZE:
+        priv->read_buffer_size = g_value_get_uint(val);
+        break;
+    case SEQ_USER_CLIENT_PROP_DISPATCH_BUDGET:
+        priv->dispatch_budget = g_value_get_uint(val);
+        break;
+    case SEQ_USER_CLIENT_PROP_DISPATCH_EVENT_BUDGET:
+        priv->dispatch_event_budget = g_value_get_uint(val);
+        break;
+    default:
+        G_OBJECT_WARN_INVALID_PROPERTY_ID(obj, id, spec);
+        break;
+    }
+}
+
 static void seq_user_client_get_property(GObject *obj, guint id, GValue *val,
                                          GParamSpec *spec)
 {
@@ -85,18 +198,77 @@ static void seq_user_client_get_property(GObject *obj, guint id, GValue *val,
     case SEQ_USER_CLIENT_PROP_CLIENT_ID:
         g_value_set_uchar(val, (guint8)priv->client_id);
         break;
+    case SEQ_USER_CLIENT_PROP_READ_BUFFER_SIZE:
+        g_value_set_uint(val, priv->read_buffer_size);
+        break;
+    case SEQ_USER_CLIENT_PROP_DISPATCH_BUDGET:
+        g_value_set_uint(val, priv->dispatch_budget);
+        break;
+    case SEQ_USER_CLIENT_PROP_DISPATCH_EVENT_BUDGET:
+        g_value_set_uint(val, priv->dispatch_event_budget);
+        break;
+    case SEQ_USER_CLIENT_PROP_READER_OVERRUN_COUNT:
+        g_mutex_lock(&priv->reader_lock);
+        if (priv->reader != NULL)
+            g_value_set_uint(val, seq_event_ring_get_overrun_count(priv->reader->ring));
+        else
+            g_value_set_uint(val, 0);
+        g_mutex_unlock(&priv->reader_lock);
+        break;
+    case SEQ_USER_CLIENT_PROP_READER_HIGH_WATERMARK:
+        g_mutex_lock(&priv->reader_lock);
+        if (priv->reader != NULL)
+            g_value_set_uint(val, seq_event_ring_get_high_watermark(priv->reader->ring));
+        else
+            g_value_set_uint(val, 0);
+        g_mutex_unlock(&priv->reader_lock);
+        break;
+    case SEQ_USER_CLIENT_PROP_READER_DISCONNECTED:
+        g_mutex_lock(&priv->reader_lock);
+        if (priv->reader != NULL)
+            g_value_set_boolean(val, g_atomic_int_get(&priv->reader->disconnected));
+        else
+            g_value_set_boolean(val, FALSE);
+        g_mutex_unlock(&priv->reader_lock);
+        break;
     default:
         G_OBJECT_WARN_INVALID_PROPERTY_ID(obj, id, spec);
         break;
     }
 }
 
+static void seq_event_filter_free(struct seq_event_filter *filter)
+{
+    g_free(filter->sources);
+    g_free(filter);
+}
+
+static struct seq_event_filter *seq_event_filter_copy(const struct seq_event_filter *filter)
+{
+    struct seq_event_filter *copy = g_malloc(sizeof(*copy));
+
+    memcpy(copy, filter, sizeof(*copy));
+    if (filter->sources != NULL) {
+        copy->sources = g_malloc(SOURCE_FILTER_BITMAP_SIZE);
+        memcpy(copy->sources, filter->sources, SOURCE_FILTER_BITMAP_SIZE);
+    }
+
+    return copy;
+}
+
 static void seq_user_client_finalize(GObject *obj)
 {
     ALSASeqUserClient *self = ALSASEQ_USER_CLIENT(obj);
     ALSASeqUserClientPrivate *priv =
                                 alsaseq_user_client_get_instance_private(self);
 
+    alsaseq_user_client_stop_reader(self);
+    g_mutex_clear(&priv->reader_lock);
+    alsaseq_user_client_set_event_handler(self, NULL, NULL, NULL);
+    g_mutex_clear(&priv->handler_lock);
+    seq_event_filter_free(priv->filter);
+    g_mutex_clear(&priv->filter_lock);
+
     if (priv->fd >= 0)
         close(priv->fd);
     g_free((gpointer)priv->devnode);
@@ -109,6 +281,7 @@ static void alsaseq_user_client_class_init(ALSASeqUserClientClass *klass)
     GObjectClass *gobject_class = G_OBJECT_CLASS(klass);
 
     gobject_class->finalize = seq_user_client_finalize;
+    gobject_class->set_property = seq_user_client_set_property;
     gobject_class->get_property = seq_user_client_get_property;
 
     /**
@@ -123,6 +296,107 @@ static void alsaseq_user_client_class_init(ALSASeqUserClientClass *klass)
                            0,
                            G_PARAM_READABLE);
 
+    /**
+     * ALSASeqUserClient:read-buffer-size:
+     *
+     * The size of buffer in byte unit for the `read(2)` system call in the source created by
+     * [method@UserClient.create_source]. When zero, the size is decided so that the buffer can
+     * store events as many as cells in memory pool for input direction of the client, expressed
+     * by [property@ClientPool:input-pool]. The value is referred when the source is created.
+     *
+     * Since: 0.4.
+     */
+    seq_user_client_props[SEQ_USER_CLIENT_PROP_READ_BUFFER_SIZE] =
+        g_param_spec_uint("read-buffer-size", "read-buffer-size",
+                          "The size of buffer in byte unit for the read(2) system call.",
+                          0, G_MAXINT,
+                          0,
+                          G_PARAM_READWRITE);
+
+    /**
+     * ALSASeqUserClient:dispatch-budget:
+     *
+     * The maximum size in byte unit of events read in a dispatch of the source. When both of the
+     * budget and [property@UserClient:dispatch-event-budget] are zero, the `read(2)` system call
+     * is executed once in the dispatch. Else, the system call is executed repeatedly till no event
+     * is available or the total size of read events reaches the budget. The
+     * [signal@UserClient::handle-event] signal is emitted once in the dispatch for all of the read
+     * events, thus the buffer is expanded up to the sum of the budget and
+     * [property@UserClient:read-buffer-size].
+     *
+     * Since: 0.4.
+     */
+    seq_user_client_props[SEQ_USER_CLIENT_PROP_DISPATCH_BUDGET] =
+        g_param_spec_uint("dispatch-budget", "dispatch-budget",
+                          "The maximum size in byte unit of events read in a dispatch.",
+                          0, G_MAXUINT,
+                          0,
+                          G_PARAM_READWRITE);
+
+    /**
+     * ALSASeqUserClient:dispatch-event-budget:
+     *
+     * The maximum number of events read in a dispatch of the source. When not zero, the `read(2)`
+     * system call is executed repeatedly till no event is available or the number of read events
+     * reaches the budget. It is useful to bound the latency of dispatch independently of the
+     * size of events, since the events of variable length type occupy more bytes than the others.
+     * When [property@UserClient:dispatch-budget] is not zero as well, the system call is not
+     * executed anymore once either of the budgets is exhausted.
+     *
+     * Since: 0.4.
+     */
+    seq_user_client_props[SEQ_USER_CLIENT_PROP_DISPATCH_EVENT_BUDGET] =
+        g_param_spec_uint("dispatch-event-budget", "dispatch-event-budget",
+                          "The maximum number of events read in a dispatch.",
+                          0, G_MAXUINT,
+                          0,
+                          G_PARAM_READWRITE);
+
+    /**
+     * ALSASeqUserClient:reader-overrun-count:
+     *
+     * The number of batches of events dropped by the thread started by
+     * [method@UserClient.start_reader] since the ring buffer has no space for them.
+     *
+     * Since: 0.4.
+     */
+    seq_user_client_props[SEQ_USER_CLIENT_PROP_READER_OVERRUN_COUNT] =
+        g_param_spec_uint("reader-overrun-count", "reader-overrun-count",
+                          "The number of batches of events dropped due to full of ring buffer.",
+                          0, G_MAXUINT,
+                          0,
+                          G_PARAM_READABLE);
+
+    /**
+     * ALSASeqUserClient:reader-high-watermark:
+     *
+     * The maximum size in byte unit used in the ring buffer for the thread started by
+     * [method@UserClient.start_reader]. It is useful to decide the size of ring buffer.
+     *
+     * Since: 0.4.
+     */
+    seq_user_client_props[SEQ_USER_CLIENT_PROP_READER_HIGH_WATERMARK] =
+        g_param_spec_uint("reader-high-watermark", "reader-high-watermark",
+                          "The maximum size in byte unit used in the ring buffer.",
+                          0, G_MAXUINT,
+                          0,
+                          G_PARAM_READABLE);
+
+    /**
+     * ALSASeqUserClient:reader-disconnected:
+     *
+     * Whether the thread started by [method@UserClient.start_reader] finished by itself since
+     * ALSA sequencer character device is not available anymore. The batches of events passed to
+     * the ring buffer before are still available.
+     *
+     * Since: 0.4.
+     */
+    seq_user_client_props[SEQ_USER_CLIENT_PROP_READER_DISCONNECTED] =
+        g_param_spec_boolean("reader-disconnected", "reader-disconnected",
+                             "Whether the thread finished since the device is not available.",
+                             FALSE,
+                             G_PARAM_READABLE);
+
     g_object_class_install_properties(gobject_class,
                                       SEQ_USER_CLIENT_PROP_COUNT,
                                       seq_user_client_props);
@@ -150,6 +424,11 @@ static void alsaseq_user_client_init(ALSASeqUserClient *self)
     ALSASeqUserClientPrivate *priv =
                                 alsaseq_user_client_get_instance_private(self);
     priv->fd = -1;
+    g_mutex_init(&priv->reader_lock);
+    g_mutex_init(&priv->handler_lock);
+    g_mutex_init(&priv->filter_lock);
+    priv->filter = g_malloc0(sizeof(*priv->filter));
+    priv->filter->channels = G_MAXUINT16;
 }
 
 /**
@@ -579,8 +858,10 @@ gboolean alsaseq_user_client_schedule_event(ALSASeqUserClient *self, const ALSAS
         return FALSE;
     }
 
+    // NOTE: ALSA Sequencer core expects the blob data of variable type to follow the event. It is
+    // copied just when the event points to the blob data in the other buffer.
     length = seq_event_calculate_flattened_length(event, FALSE);
-    if (length == sizeof(*event)) {
+    if (seq_event_is_flattened(event)) {
         buf = (guint8 *)event;
     } else {
         buf = g_malloc0(length);
@@ -589,7 +870,7 @@ gboolean alsaseq_user_client_schedule_event(ALSASeqUserClient *self, const ALSAS
     }
 
     result = write(priv->fd, buf, length);
-    if (length != sizeof(*event))
+    if (buf != (guint8 *)event)
         g_free(buf);
     if (result < 0) {
         GFileError code = g_file_error_from_errno(errno);
@@ -607,6 +888,30 @@ gboolean alsaseq_user_client_schedule_event(ALSASeqUserClient *self, const ALSAS
     return TRUE;
 }
 
+// Write the events in the contiguous buffer by one system call, then count the events written
+// entirely. The unit is the length of each event in the buffer.
+static gboolean write_event_run(ALSASeqUserClientPrivate *priv, const guint8 *buf, gsize length,
+                                gsize unit, gsize *written, GError **error)
+{
+    ssize_t result;
+
+    result = write(priv->fd, buf, length);
+    if (result < 0) {
+        GFileError code = g_file_error_from_errno(errno);
+
+        if (code != G_FILE_ERROR_FAILED)
+            generate_file_error(error, errno, "write(%s)", priv->devnode);
+        else
+            generate_syscall_error(error, errno, "write(%s)", priv->devnode);
+
+        return FALSE;
+    }
+
+    *written = (gsize)result / unit;
+
+    return TRUE;
+}
+
 /**
  * alsaseq_user_client_schedule_events:
  * @self: A [class@UserClient].
@@ -615,12 +920,17 @@ gboolean alsaseq_user_client_schedule_event(ALSASeqUserClient *self, const ALSAS
  * @error: A [struct@GLib.Error]. Error is generated with two domains; `GLib.FileError` and
  *         `ALSASeq.UserClientError`.
  *
- * Deliver the events immediately, or schedule it into memory pool of the client.
+ * Deliver the events immediately, or schedule it into memory pool of the client. The events of
+ * fixed length are gathered into one buffer. The event of [enum@EventLengthMode].VARIABLE type is
+ * passed to the system call separately, without copying when its blob data follows the event in
+ * the same buffer.
  *
- * The call of function executes `write(2)` system call for ALSA sequencer character device. When
+ * The call of function executes `write(2)` system call for ALSA sequencer character device, once
+ * for each run of events with fixed length and once for each event with variable length. When
  * [property@ClientPool:output-free] is less than sum of [method@Event.calculate_pool_consumption]
  * and [method@UserClient.open] is called without non-blocking flag, the user process can be
- * blocked untill enough number of cells becomes available.
+ * blocked untill enough number of cells becomes available. When any of the system calls fails,
+ * the number of events scheduled by the former system calls is still returned by @count.
  *
  * Returns: %TRUE when the overall operation finishes successfully, else %FALSE.
  */
@@ -628,19 +938,22 @@ gboolean alsaseq_user_client_schedule_events(ALSASeqUserClient *self, const GLis
                                              gsize *count, GError **error)
 {
     ALSASeqUserClientPrivate *priv;
-    ALSASeqEventCntr cntr = { 0 };
     const GList *entry;
     gsize index;
+    gsize fixed_count;
+    guint8 *buf;
     gsize pos;
-    ssize_t result;
     gsize scheduled;
+    gboolean result;
 
     g_return_val_if_fail(ALSASEQ_IS_USER_CLIENT(self), FALSE);
     priv = alsaseq_user_client_get_instance_private(self);
 
+    g_return_val_if_fail(count != NULL, FALSE);
     g_return_val_if_fail(error == NULL || *error == NULL, FALSE);
 
     index = 0;
+    fixed_count = 0;
     for (entry = events; entry != NULL; entry = g_list_next(entry)) {
         const struct snd_seq_event *ev = (const struct snd_seq_event *)entry->data;
 
@@ -652,17 +965,158 @@ gboolean alsaseq_user_client_schedule_events(ALSASeqUserClient *self, const GLis
                         index);
             return FALSE;
         }
+
+        if ((ev->flags & SNDRV_SEQ_EVENT_LENGTH_MASK) != SNDRV_SEQ_EVENT_LENGTH_VARIABLE)
+            ++fixed_count;
+        ++index;
+    }
+
+    *count = 0;
+
+    // Nothing to do.
+    if (index == 0)
+        return TRUE;
+
+    // NOTE: ALSA sequencer core expects the blob data of variable type to follow the event in the
+    // buffer given to one write operation, while the character device has no support of
+    // scatter-gather operation; i.e. writev(2) results in one write operation per vector. The
+    // events of fixed length are gathered into one buffer so that they are written at once.
+    if (fixed_count > 0)
+        buf = g_malloc(sizeof(struct snd_seq_event) * fixed_count);
+    else
+        buf = NULL;
+
+    pos = 0;
+    scheduled = 0;
+    result = TRUE;
+    for (entry = events; entry != NULL; entry = g_list_next(entry)) {
+        const struct snd_seq_event *ev = (const struct snd_seq_event *)entry->data;
+        gsize length;
+        gsize written;
+        gboolean partial;
+
+        if ((ev->flags & SNDRV_SEQ_EVENT_LENGTH_MASK) != SNDRV_SEQ_EVENT_LENGTH_VARIABLE) {
+            memcpy(buf + pos, ev, sizeof(*ev));
+            pos += sizeof(*ev);
+            continue;
+        }
+
+        // Flush the former events of fixed length to keep the order of events.
+        if (pos > 0) {
+            result = write_event_run(priv, buf, pos, sizeof(*ev), &written, error);
+            if (!result)
+                break;
+            scheduled += written;
+            partial = written * sizeof(*ev) < pos;
+            pos = 0;
+            if (partial)
+                break;
+        }
+
+        // NOTE: The blob data is copied just when the event points to the blob data in the other
+        // buffer, since ALSA sequencer core does not expand the blob data pointed by the event
+        // with LENGTH_VARUSR flag for receivers.
+        length = seq_event_calculate_flattened_length(ev, FALSE);
+        if (seq_event_is_flattened(ev)) {
+            result = write_event_run(priv, (const guint8 *)ev, length, length, &written, error);
+        } else {
+            guint8 *blob = g_malloc(length);
+
+            seq_event_copy_flattened(ev, blob, length);
+            result = write_event_run(priv, blob, length, length, &written, error);
+            g_free(blob);
+        }
+        if (!result)
+            break;
+        scheduled += written;
+        if (written == 0)
+            break;
+    }
+
+    if (result && pos > 0) {
+        gsize written;
+
+        result = write_event_run(priv, buf, pos, sizeof(struct snd_seq_event), &written, error);
+        if (result)
+            scheduled += written;
+    }
+
+    g_free(buf);
+
+    // NOTE: The events written by the former system calls are already scheduled.
+    *count = scheduled;
+
+    return result;
+}
+
+/**
+ * alsaseq_user_client_schedule_event_cntr:
+ * @self: A [class@UserClient].
+ * @ev_cntr: A [struct@EventCntr] which includes batch of events.
+ * @count: (out): The number of events to be scheduled.
+ * @error: A [struct@GLib.Error]. Error is generated with two domains; `GLib.FileError` and
+ *         `ALSASeq.UserClientError`.
+ *
+ * Deliver the events in the container immediately, or schedule them into memory pool of the
+ * client. The flatten buffer of container is passed to ALSA sequencer character device as is,
+ * thus no memory is allocated. When the buffer has padding after blob data of
+ * [enum@EventLengthMode].VARIABLE type of event, the call results in failure since ALSA Sequencer
+ * core can not handle the layout.
+ *
+ * The call of function executes `write(2)` system call for ALSA sequencer character device. When
+ * [property@ClientPool:output-free] is less than sum of [method@Event.calculate_pool_consumption]
+ * and [method@UserClient.open] is called without non-blocking flag, the user process can be
+ * blocked untill enough number of cells becomes available. The number of events which the
+ * system call wrote entirely is returned by @count.
+ *
+ * Returns: %TRUE when the overall operation finishes successfully, else %FALSE.
+ *
+ * Since: 0.4.
+ */
+gboolean alsaseq_user_client_schedule_event_cntr(ALSASeqUserClient *self,
+                                                 const ALSASeqEventCntr *ev_cntr, gsize *count,
+                                                 GError **error)
+{
+    ALSASeqUserClientPrivate *priv;
+    ALSASeqEventCntrIter iter;
+    const struct snd_seq_event *ev;
+    gsize index;
+    gsize pos;
+    ssize_t result;
+    gsize scheduled;
+
+    g_return_val_if_fail(ALSASEQ_IS_USER_CLIENT(self), FALSE);
+    priv = alsaseq_user_client_get_instance_private(self);
+
+    g_return_val_if_fail(ev_cntr != NULL, FALSE);
+    g_return_val_if_fail(count != NULL, FALSE);
+    g_return_val_if_fail(error == NULL || *error == NULL, FALSE);
+
+    // NOTE: The events are not passed to accessors, thus the buffer of container is not modified.
+    index = 0;
+    seq_event_iter_init(&iter, ev_cntr->buf, ev_cntr->length, ev_cntr->aligned);
+    while ((ev = seq_event_iter_next(&iter))) {
+        // NOTE: ALSA Sequencer core expects no padding after blob data.
+        if (!seq_event_is_deliverable(ev) ||
+            (ev_cntr->aligned && seq_event_calculate_flattened_length(ev, TRUE) !=
+                                 seq_event_calculate_flattened_length(ev, FALSE))) {
+            g_set_error(error, ALSASEQ_USER_CLIENT_ERROR,
+                        ALSASEQ_USER_CLIENT_ERROR_EVENT_UNDELIVERABLE,
+                        "The operation fails due to undeliverable event: index %lu",
+                        index);
+            return FALSE;
+        }
         ++index;
     }
+    g_return_val_if_fail(iter.offset == ev_cntr->length, FALSE);
 
-    seq_event_cntr_serialize(&cntr, events, FALSE);
+    *count = 0;
 
     // Nothing to do.
-    if (cntr.length == 0)
+    if (ev_cntr->length == 0)
         return TRUE;
 
-    result = write(priv->fd, cntr.buf, cntr.length);
-    g_free(cntr.buf);
+    result = write(priv->fd, ev_cntr->buf, ev_cntr->length);
     if (result < 0) {
         GFileError code = g_file_error_from_errno(errno);
 
@@ -674,144 +1128,995 @@ gboolean alsaseq_user_client_schedule_events(ALSASeqUserClient *self, const GLis
         return FALSE;
     }
 
-    // Compute the count of scheduled events.
+    // Compute the count of events written entirely.
     pos = 0;
     scheduled = 0;
-    for (entry = events; entry != NULL; entry = g_list_next(entry)) {
-        const struct snd_seq_event *ev = (const struct snd_seq_event *)entry->data;
-
-        ++scheduled;
-
-        pos += seq_event_calculate_flattened_length(ev, FALSE);
-        if (pos >= result)
+    seq_event_iter_init(&iter, ev_cntr->buf, ev_cntr->length, ev_cntr->aligned);
+    while ((ev = seq_event_iter_next(&iter))) {
+        pos += seq_event_calculate_flattened_length(ev, ev_cntr->aligned);
+        if (pos > (gsize)result)
             break;
+        ++scheduled;
     }
 
-    g_return_val_if_fail(result == pos, FALSE);
-
     *count = scheduled;
 
     return TRUE;
 }
 
-static gboolean seq_user_client_check_src(GSource *gsrc)
+static void seq_event_handler_unref(struct seq_event_handler *handler)
 {
-    UserClientSource *src = (UserClientSource *)gsrc;
-    GIOCondition condition;
-
-    // Don't go to dispatch if nothing available. As an exception, return TRUE
-    // for POLLERR to call .dispatch for internal destruction.
-    condition = g_source_query_unix_fd(gsrc, src->tag);
-    return !!(condition & (G_IO_IN | G_IO_ERR));
+    if (g_atomic_int_dec_and_test(&handler->ref_count)) {
+        if (handler->destroy != NULL)
+            handler->destroy(handler->data);
+        g_free(handler);
+    }
 }
 
-static gboolean seq_user_client_dispatch_src(GSource *gsrc, GSourceFunc cb,
-                                             gpointer user_data)
+/**
+ * alsaseq_user_client_set_event_handler:
+ * @self: A [class@UserClient].
+ * @handler: (scope notified) (nullable): The function to handle batch of events.
+ * @user_data: (closure): The data passed to the handler.
+ * @destroy: (destroy user_data) (nullable): The function to release the data.
+ *
+ * Install the function to handle batch of events instead of [signal@UserClient::handle-event]
+ * signal. The function is called directly in the dispatch of source returned by
+ * [method@UserClient.create_source] and [method@UserClient.create_reader_source] with the buffer
+ * borrowed from the source, thus it can avoid the overhead of signal emission and the copy of
+ * container for the signal. The signal is not emitted while the function is installed. When %NULL
+ * is passed to the handler, the function installed previously is removed and the signal is
+ * emitted again.
+ *
+ * The function can be replaced while the sources dispatch in the other threads. In the case, the
+ * function installed previously is kept till the running call of the function returns, then
+ * @destroy for the previous data is called in the thread.
+ *
+ * Since: 0.4.
+ */
+void alsaseq_user_client_set_event_handler(ALSASeqUserClient *self,
+                                           ALSASeqUserClientEventHandler handler,
+                                           gpointer user_data, GDestroyNotify destroy)
 {
-    UserClientSource *src = (UserClientSource *)gsrc;
-    ALSASeqUserClient *self = src->self;
     ALSASeqUserClientPrivate *priv;
-    GIOCondition condition;
-    ALSASeqEventCntr ev_cntr = { 0 };
-    int len;
+    struct seq_event_handler *entry;
+    struct seq_event_handler *prev;
 
+    g_return_if_fail(ALSASEQ_IS_USER_CLIENT(self));
     priv = alsaseq_user_client_get_instance_private(self);
-    if (priv->fd < 0)
-        return G_SOURCE_REMOVE;
-
-    condition = g_source_query_unix_fd(gsrc, src->tag);
-    if (condition & G_IO_ERR)
-        return G_SOURCE_REMOVE;
-
-    len = read(priv->fd, src->buf, src->buf_len);
-    if (len < 0) {
-        if (errno == EAGAIN)
-            return G_SOURCE_CONTINUE;
 
-        return G_SOURCE_REMOVE;
+    if (handler != NULL) {
+        entry = g_malloc0(sizeof(*entry));
+        entry->ref_count = 1;
+        entry->func = handler;
+        entry->data = user_data;
+        entry->destroy = destroy;
+    } else {
+        entry = NULL;
     }
 
-    // NOTE: The buffer is flatten layout.
-    ev_cntr.buf = src->buf;
-    ev_cntr.length = len;
-    ev_cntr.aligned = TRUE;
+    g_mutex_lock(&priv->handler_lock);
+    prev = priv->event_handler;
+    priv->event_handler = entry;
+    g_mutex_unlock(&priv->handler_lock);
 
-    g_signal_emit(self, seq_user_client_sigs[SEQ_USER_CLIENT_SIG_TYPE_HANDLE_EVENT], 0, &ev_cntr);
+    if (prev != NULL)
+        seq_event_handler_unref(prev);
+}
 
-    // Just be sure to continue to process this source.
-    return G_SOURCE_CONTINUE;
+static void seq_user_client_handle_event(ALSASeqUserClient *self, ALSASeqUserClientPrivate *priv,
+                                         ALSASeqEventCntr *ev_cntr)
+{
+    struct seq_event_handler *handler;
+
+    // NOTE: The handler is referred so that it is available even if it is replaced in the other
+    // thread during the call.
+    g_mutex_lock(&priv->handler_lock);
+    handler = priv->event_handler;
+    if (handler != NULL)
+        g_atomic_int_inc(&handler->ref_count);
+    g_mutex_unlock(&priv->handler_lock);
+
+    // NOTE: The installed handler has precedence over the signal to skip marshalling.
+    if (handler != NULL) {
+        handler->func(self, ev_cntr, handler->data);
+        seq_event_handler_unref(handler);
+    } else {
+        g_signal_emit(self, seq_user_client_sigs[SEQ_USER_CLIENT_SIG_TYPE_HANDLE_EVENT], 0,
+                      ev_cntr);
+    }
 }
 
-static void seq_user_client_finalize_src(GSource *gsrc)
+// Publish the new set of filters, then release the previous one. The call should be done with
+// filter_lock held.
+static void publish_event_filter(ALSASeqUserClientPrivate *priv, struct seq_event_filter *filter)
 {
-    UserClientSource *src = (UserClientSource *)gsrc;
+    struct seq_event_filter *prev = priv->filter;
 
-    g_free(src->buf);
-    g_object_unref(src->self);
+    g_atomic_pointer_set(&priv->filter, filter);
+
+    // NOTE: The readers count themselves before loading the pointer, thus the ones which can refer
+    // to the previous set are finished when the counter is zero.
+    while (g_atomic_int_get(&priv->filter_readers) > 0)
+        g_thread_yield();
+
+    seq_event_filter_free(prev);
 }
 
 /**
- * alsaseq_user_client_create_source:
+ * alsaseq_user_client_set_event_type_filter:
  * @self: A [class@UserClient].
- * @gsrc: (out): A #GSource to handle events from ALSA seq character device.
- * @error: A [struct@GLib.Error].
+ * @event_types: (array length=event_type_count)(nullable): The array with elements for the type of
+ *               event to handle.
+ * @event_type_count: The number of elements for the type of event.
+ * @error: A [struct@GLib.Error]. Error is generated with domain of `ALSASeq.UserClientError`.
  *
- * Allocate [struct@GLib.Source] structure to handle events from ALSA seq character device. In each
- * iteration of [struct@GLib.MainContext], the `read(2)` system call is exected to dispatch
- * sequencer event for [signal@UserClient::handle-event] signal, according to the result of
- * `poll(2)` system call.
+ * Configure the types of event to be handled by the sources. The filter is programmed to ALSA
+ * Sequencer core as well, thus the events of the other types are not delivered to the client. When
+ * no type is given, the filter is disabled.
+ *
+ * The call of function executes `ioctl(2)` system call with `SNDRV_SEQ_IOCTL_GET_CLIENT_INFO` and
+ * `SNDRV_SEQ_IOCTL_SET_CLIENT_INFO` commands for ALSA sequencer character device.
  *
  * Returns: %TRUE when the overall operation finishes successfully, else %FALSE.
+ *
+ * Since: 0.4.
  */
-gboolean alsaseq_user_client_create_source(ALSASeqUserClient *self, GSource **gsrc, GError **error)
+gboolean alsaseq_user_client_set_event_type_filter(ALSASeqUserClient *self,
+                                                   const ALSASeqEventType *event_types,
+                                                   gsize event_type_count, GError **error)
 {
-    static GSourceFuncs funcs = {
-            .check          = seq_user_client_check_src,
-            .dispatch       = seq_user_client_dispatch_src,
-            .finalize       = seq_user_client_finalize_src,
-    };
     ALSASeqUserClientPrivate *priv;
-    UserClientSource *src;
-    void *buf;
-    long page_size = sysconf(_SC_PAGESIZE);
+    struct snd_seq_client_info info = {0};
+    struct seq_event_filter *filter;
+    int i;
 
     g_return_val_if_fail(ALSASEQ_IS_USER_CLIENT(self), FALSE);
     priv = alsaseq_user_client_get_instance_private(self);
     g_return_val_if_fail(priv->fd >= 0, FALSE);
 
-    g_return_val_if_fail(gsrc != NULL, FALSE);
+    g_return_val_if_fail(event_types != NULL || event_type_count == 0, FALSE);
     g_return_val_if_fail(error == NULL || *error == NULL, FALSE);
 
-    buf = g_malloc0(page_size);
+    info.client = priv->client_id;
+    if (ioctl(priv->fd, SNDRV_SEQ_IOCTL_GET_CLIENT_INFO, &info) < 0) {
+        generate_syscall_error(error, errno, "ioctl(%s)", "GET_CLIENT_INFO");
+        return FALSE;
+    }
 
-    *gsrc = g_source_new(&funcs, sizeof(*src));
-    src = (UserClientSource *)(*gsrc);
+    memset(info.event_filter, 0, sizeof(info.event_filter));
+    for (i = 0; i < event_type_count; ++i) {
+        unsigned int order = event_types[i] / (sizeof(info.event_filter[0]) * 8);
+        unsigned int idx = event_types[i] % (sizeof(info.event_filter[0]) * 8);
 
-    g_source_set_name(*gsrc, "ALSASeqUserClient");
-    g_source_set_priority(*gsrc, G_PRIORITY_HIGH_IDLE);
-    g_source_set_can_recurse(*gsrc, TRUE);
+        if (order < G_N_ELEMENTS(info.event_filter))
+            info.event_filter[order] |= 1u << idx;
+    }
 
-    src->self = g_object_ref(self);
-    src->tag = g_source_add_unix_fd(*gsrc, priv->fd, G_IO_IN);
-    src->buf = buf;
-    src->buf_len = page_size;
+    if (event_type_count > 0)
+        info.filter |= SNDRV_SEQ_FILTER_USE_EVENT;
+    else
+        info.filter &= ~SNDRV_SEQ_FILTER_USE_EVENT;
+
+    info.type = USER_CLIENT;
+    if (ioctl(priv->fd, SNDRV_SEQ_IOCTL_SET_CLIENT_INFO, &info) < 0) {
+        generate_syscall_error(error, errno, "ioctl(%s)", "SET_CLIENT_INFO");
+        return FALSE;
+    }
+
+    // NOTE: The same table is kept for the case that the client information is changed later.
+    G_STATIC_ASSERT(sizeof(filter->types) == sizeof(info.event_filter));
+    g_mutex_lock(&priv->filter_lock);
+    filter = seq_event_filter_copy(priv->filter);
+    memcpy(filter->types, info.event_filter, sizeof(filter->types));
+    filter->by_type = event_type_count > 0;
+    publish_event_filter(priv, filter);
+    g_mutex_unlock(&priv->filter_lock);
 
     return TRUE;
 }
 
 /**
- * alsaseq_user_client_operate_subscription:
+ * alsaseq_user_client_add_source_filter:
  * @self: A [class@UserClient].
- * @subs_data: A [class@SubscribeData].
- * @establish: Whether to establish subscription between two ports, or break it.
- * @error: A [struct@GLib.Error]. Error is generated with domain of `ALSASeq.UserClientError`.
- *
- * Operate subscription between two ports pointed by the data.
+ * @client_id: The numeric ID of client as the source of events.
+ * @port_id_min: The minimum numeric ID of port as the source of events.
+ * @port_id_max: The maximum numeric ID of port as the source of events.
  *
- * The call of function executes `ioctl(2)` system call with `SNDRV_SEQ_IOCTL_SUBSCRIBE_PORT` and
- * `SNDRV_SEQ_IOCTL_UNSUBSCRIBE_PORT` commands for ALSA sequencer character device.
+ * Add the range of address for the source of events to be handled by the sources. When any range
+ * is added, the events from the address out of the ranges are discarded before they are handled.
  *
- * Returns: %TRUE when the overall operation finishes successfully, else %FALSE.
+ * Since: 0.4.
+ */
+void alsaseq_user_client_add_source_filter(ALSASeqUserClient *self, guint8 client_id,
+                                           guint8 port_id_min, guint8 port_id_max)
+{
+    ALSASeqUserClientPrivate *priv;
+    struct seq_event_filter *filter;
+    guint8 *bitmap;
+    guint port_id;
+
+    g_return_if_fail(ALSASEQ_IS_USER_CLIENT(self));
+    priv = alsaseq_user_client_get_instance_private(self);
+
+    g_return_if_fail(port_id_min <= port_id_max);
+
+    g_mutex_lock(&priv->filter_lock);
+
+    filter = seq_event_filter_copy(priv->filter);
+
+    // NOTE: The bitmap has a bit for each pair of client and port, thus the address is looked up
+    // without scanning the ranges.
+    if (filter->sources == NULL)
+        filter->sources = g_malloc0(SOURCE_FILTER_BITMAP_SIZE);
+
+    bitmap = filter->sources + client_id * SOURCE_FILTER_BITMAP_STRIDE;
+    for (port_id = port_id_min; port_id <= port_id_max; ++port_id)
+        bitmap[port_id / 8] |= 1u << (port_id % 8);
+
+    publish_event_filter(priv, filter);
+
+    g_mutex_unlock(&priv->filter_lock);
+}
+
+/**
+ * alsaseq_user_client_set_channel_filter:
+ * @self: A [class@UserClient].
+ * @channel_mask: The bit mask of MIDI channels to handle. The least significant bit corresponds to
+ *                the first channel.
+ *
+ * Configure the channels of events to be handled by the sources. The events for note and control
+ * in the channels out of the mask are discarded before they are handled. The other types of event
+ * are not filtered.
+ *
+ * Since: 0.4.
+ */
+void alsaseq_user_client_set_channel_filter(ALSASeqUserClient *self, guint16 channel_mask)
+{
+    ALSASeqUserClientPrivate *priv;
+    struct seq_event_filter *filter;
+
+    g_return_if_fail(ALSASEQ_IS_USER_CLIENT(self));
+    priv = alsaseq_user_client_get_instance_private(self);
+
+    g_mutex_lock(&priv->filter_lock);
+    filter = seq_event_filter_copy(priv->filter);
+    filter->channels = channel_mask;
+    publish_event_filter(priv, filter);
+    g_mutex_unlock(&priv->filter_lock);
+}
+
+/**
+ * alsaseq_user_client_clear_event_filters:
+ * @self: A [class@UserClient].
+ * @error: A [struct@GLib.Error]. Error is generated with domain of `ALSASeq.UserClientError`.
+ *
+ * Disable all of filters configured by the call of [method@UserClient.set_event_type_filter],
+ * [method@UserClient.add_source_filter], and [method@UserClient.set_channel_filter].
+ *
+ * Returns: %TRUE when the overall operation finishes successfully, else %FALSE.
+ *
+ * Since: 0.4.
+ */
+gboolean alsaseq_user_client_clear_event_filters(ALSASeqUserClient *self, GError **error)
+{
+    ALSASeqUserClientPrivate *priv;
+    struct seq_event_filter *filter;
+
+    g_return_val_if_fail(ALSASEQ_IS_USER_CLIENT(self), FALSE);
+    priv = alsaseq_user_client_get_instance_private(self);
+
+    g_return_val_if_fail(error == NULL || *error == NULL, FALSE);
+
+    g_mutex_lock(&priv->filter_lock);
+    filter = seq_event_filter_copy(priv->filter);
+    g_free(filter->sources);
+    filter->sources = NULL;
+    filter->channels = G_MAXUINT16;
+    publish_event_filter(priv, filter);
+    g_mutex_unlock(&priv->filter_lock);
+
+    return alsaseq_user_client_set_event_type_filter(self, NULL, 0, error);
+}
+
+static gboolean seq_user_client_accept_event(const struct seq_event_filter *filter,
+                                             const struct snd_seq_event *ev)
+{
+    guint channel;
+
+    // NOTE: The table is byte-oriented as the one in ALSA Sequencer core.
+    if (filter->by_type) {
+        if (!(filter->types[ev->type / 8] & (1u << (ev->type % 8))))
+            return FALSE;
+    }
+
+    if (filter->sources != NULL) {
+        const guint8 *bitmap = filter->sources + ev->source.client * SOURCE_FILTER_BITMAP_STRIDE;
+
+        if (!(bitmap[ev->source.port / 8] & (1u << (ev->source.port % 8))))
+            return FALSE;
+    }
+
+    if (filter->channels != G_MAXUINT16) {
+        if (ev->type >= SNDRV_SEQ_EVENT_NOTE && ev->type <= SNDRV_SEQ_EVENT_KEYPRESS)
+            channel = ev->data.note.channel;
+        else if (ev->type >= SNDRV_SEQ_EVENT_CONTROLLER && ev->type <= SNDRV_SEQ_EVENT_REGPARAM)
+            channel = ev->data.control.channel;
+        else
+            return TRUE;
+
+        if (!(filter->channels & (1u << (channel & 0x0f))))
+            return FALSE;
+    }
+
+    return TRUE;
+}
+
+// Discard the events in the buffer of aligned layout according to the filters, then return the
+// length of remaining events.
+static gsize seq_user_client_filter_events(ALSASeqUserClientPrivate *priv, guint8 *buf,
+                                           gsize length)
+{
+    const struct seq_event_filter *filter;
+    gsize src_pos;
+    gsize dst_pos;
+
+    // NOTE: The filters can be changed in the other threads. The set of filters is loaded after
+    // counting this thread, so that it is not released till this thread finishes referring to it.
+    g_atomic_int_inc(&priv->filter_readers);
+    filter = g_atomic_pointer_get(&priv->filter);
+
+    if (!filter->by_type && filter->sources == NULL && filter->channels == G_MAXUINT16) {
+        g_atomic_int_add(&priv->filter_readers, -1);
+        return length;
+    }
+
+    src_pos = 0;
+    dst_pos = 0;
+    while (src_pos + sizeof(struct snd_seq_event) <= length) {
+        const struct snd_seq_event *ev = (const struct snd_seq_event *)(buf + src_pos);
+        gsize ev_len = seq_event_calculate_flattened_length(ev, TRUE);
+
+        if (src_pos + ev_len > length)
+            break;
+
+        // NOTE: The events are compacted in place to avoid any copy to the other buffer.
+        if (seq_user_client_accept_event(filter, ev)) {
+            if (dst_pos != src_pos)
+                memmove(buf + dst_pos, buf + src_pos, ev_len);
+            dst_pos += ev_len;
+        }
+
+        src_pos += ev_len;
+    }
+
+    g_atomic_int_add(&priv->filter_readers, -1);
+
+    return dst_pos;
+}
+
+// Count the events in the buffer of aligned layout.
+static gsize count_events(const guint8 *buf, gsize length)
+{
+    gsize pos = 0;
+    gsize count = 0;
+
+    while (pos + sizeof(struct snd_seq_event) <= length) {
+        const struct snd_seq_event *ev = (const struct snd_seq_event *)(buf + pos);
+
+        pos += seq_event_calculate_flattened_length(ev, TRUE);
+        ++count;
+    }
+
+    return count;
+}
+
+static gboolean seq_user_client_check_src(GSource *gsrc)
+{
+    UserClientSource *src = (UserClientSource *)gsrc;
+    GIOCondition condition;
+
+    // Don't go to dispatch if nothing available. As an exception, return TRUE
+    // for POLLERR to call .dispatch for internal destruction.
+    condition = g_source_query_unix_fd(gsrc, src->tag);
+    return !!(condition & (G_IO_IN | G_IO_ERR));
+}
+
+static gboolean seq_user_client_dispatch_src(GSource *gsrc, GSourceFunc cb,
+                                             gpointer user_data)
+{
+    UserClientSource *src = (UserClientSource *)gsrc;
+    ALSASeqUserClient *self = src->self;
+    ALSASeqUserClientPrivate *priv;
+    GIOCondition condition;
+    gboolean result;
+    gsize length;
+    gsize total;
+    gsize event_count;
+
+    priv = alsaseq_user_client_get_instance_private(self);
+    if (priv->fd < 0)
+        return G_SOURCE_REMOVE;
+
+    condition = g_source_query_unix_fd(gsrc, src->tag);
+    if (condition & G_IO_ERR)
+        return G_SOURCE_REMOVE;
+
+    // Just be sure to continue to process this source.
+    result = G_SOURCE_CONTINUE;
+
+    length = 0;
+    total = 0;
+    event_count = 0;
+    while (TRUE) {
+        struct pollfd pfd;
+        ssize_t len;
+
+        // NOTE: The buffer is expanded so that all of events read in the dispatch are handled at
+        // once. The expanded buffer is kept for the later dispatches.
+        if (src->capacity < length + src->buf_len) {
+            src->capacity = length + src->buf_len;
+            src->buf = g_realloc(src->buf, src->capacity);
+        }
+
+        len = read(priv->fd, (guint8 *)src->buf + length, src->buf_len);
+        if (len < 0) {
+            if (errno != EAGAIN)
+                result = G_SOURCE_REMOVE;
+            break;
+        }
+
+        // NOTE: The events are counted before filtering since the budget is for read events.
+        if (priv->dispatch_event_budget > 0)
+            event_count += count_events((guint8 *)src->buf + length, len);
+
+        // NOTE: The buffer is flatten layout. The events read by the system call are appended to
+        // the former events without padding.
+        length += seq_user_client_filter_events(priv, (guint8 *)src->buf + length, len);
+
+        total += len;
+        if (len == 0)
+            break;
+        if (priv->dispatch_budget == 0 && priv->dispatch_event_budget == 0)
+            break;
+        if (priv->dispatch_budget > 0 && total >= priv->dispatch_budget)
+            break;
+        if (priv->dispatch_event_budget > 0 && event_count >= priv->dispatch_event_budget)
+            break;
+
+        // Check whether any event is still available without blocking the process, since the
+        // file descriptor can be opened without non-blocking flag.
+        pfd.fd = priv->fd;
+        pfd.events = POLLIN;
+        pfd.revents = 0;
+        if (poll(&pfd, 1, 0) <= 0 || !(pfd.revents & POLLIN))
+            break;
+    }
+
+    if (length > 0) {
+        // NOTE: The container borrows the buffer from the source.
+        ALSASeqEventCntr ev_cntr = { 0 };
+
+        ev_cntr.buf = src->buf;
+        ev_cntr.length = length;
+        ev_cntr.aligned = TRUE;
+
+        seq_user_client_handle_event(self, priv, &ev_cntr);
+    }
+
+    return result;
+}
+
+static void seq_user_client_finalize_src(GSource *gsrc)
+{
+    UserClientSource *src = (UserClientSource *)gsrc;
+
+    g_free(src->buf);
+    g_object_unref(src->self);
+}
+
+static gboolean decide_read_buffer_size(ALSASeqUserClientPrivate *priv, gsize *buf_len,
+                                        GError **error)
+{
+    gsize length = priv->read_buffer_size;
+
+    if (length == 0) {
+        struct snd_seq_client_pool pool = {0};
+
+        pool.client = priv->client_id;
+        if (ioctl(priv->fd, SNDRV_SEQ_IOCTL_GET_CLIENT_POOL, &pool) < 0) {
+            generate_syscall_error(error, errno, "ioctl(%s)", "GET_CLIENT_POOL");
+            return FALSE;
+        }
+
+        length = pool.input_pool * sizeof(struct snd_seq_event);
+    }
+
+    // At least, an event should be stored.
+    *buf_len = MAX(length, sizeof(struct snd_seq_event));
+
+    return TRUE;
+}
+
+/**
+ * alsaseq_user_client_create_source:
+ * @self: A [class@UserClient].
+ * @gsrc: (out): A #GSource to handle events from ALSA seq character device.
+ * @error: A [struct@GLib.Error]. Error is generated with domain of `ALSASeq.UserClientError`.
+ *
+ * Allocate [struct@GLib.Source] structure to handle events from ALSA seq character device. In each
+ * iteration of [struct@GLib.MainContext], the `read(2)` system call is exected to dispatch
+ * sequencer event for [signal@UserClient::handle-event] signal, according to the result of
+ * `poll(2)` system call. The size of buffer for the system call is decided by
+ * [property@UserClient:read-buffer-size], and the number of system calls in a dispatch is
+ * decided by [property@UserClient:dispatch-budget] and [property@UserClient:dispatch-event-budget].
+ *
+ * When [property@UserClient:read-buffer-size] is zero, the call of function executes `ioctl(2)`
+ * system call with `SNDRV_SEQ_IOCTL_GET_CLIENT_POOL` command for ALSA sequencer character device
+ * to decide the size of buffer. The call of function fails when the system call fails, then
+ * @error is set.
+ *
+ * Returns: %TRUE when the overall operation finishes successfully, else %FALSE.
+ */
+gboolean alsaseq_user_client_create_source(ALSASeqUserClient *self, GSource **gsrc, GError **error)
+{
+    static GSourceFuncs funcs = {
+            .check          = seq_user_client_check_src,
+            .dispatch       = seq_user_client_dispatch_src,
+            .finalize       = seq_user_client_finalize_src,
+    };
+    ALSASeqUserClientPrivate *priv;
+    UserClientSource *src;
+    void *buf;
+    gsize buf_len;
+
+    g_return_val_if_fail(ALSASEQ_IS_USER_CLIENT(self), FALSE);
+    priv = alsaseq_user_client_get_instance_private(self);
+    g_return_val_if_fail(priv->fd >= 0, FALSE);
+
+    g_return_val_if_fail(gsrc != NULL, FALSE);
+    g_return_val_if_fail(error == NULL || *error == NULL, FALSE);
+
+    if (!decide_read_buffer_size(priv, &buf_len, error))
+        return FALSE;
+
+    buf = g_malloc0(buf_len);
+
+    *gsrc = g_source_new(&funcs, sizeof(*src));
+    src = (UserClientSource *)(*gsrc);
+
+    g_source_set_name(*gsrc, "ALSASeqUserClient");
+    g_source_set_priority(*gsrc, G_PRIORITY_HIGH_IDLE);
+    g_source_set_can_recurse(*gsrc, TRUE);
+
+    src->self = g_object_ref(self);
+    src->tag = g_source_add_unix_fd(*gsrc, priv->fd, G_IO_IN);
+    src->buf = buf;
+    src->buf_len = buf_len;
+    src->capacity = buf_len;
+
+    return TRUE;
+}
+
+static gpointer seq_user_client_run_reader(gpointer data)
+{
+    struct seq_reader *reader = data;
+    guint64 val = 1;
+    int err = 0;
+
+    if (reader->priority > 0) {
+        struct sched_param param = { .sched_priority = reader->priority };
+
+        err = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+    }
+
+    g_mutex_lock(&reader->mutex);
+    reader->sched_err = err;
+    reader->started = TRUE;
+    g_cond_signal(&reader->cond);
+    g_mutex_unlock(&reader->mutex);
+
+    if (err != 0)
+        return NULL;
+
+    // NOTE: The loop is broken just by the request to stop, or by unavailability of the device.
+    while (TRUE) {
+        struct pollfd pfds[2] = {
+            { .fd = reader->fd, .events = POLLIN, },
+            { .fd = reader->stop_fd, .events = POLLIN, },
+        };
+        ssize_t len;
+
+        if (poll(pfds, G_N_ELEMENTS(pfds), -1) < 0) {
+            if (errno == EINTR)
+                continue;
+            break;
+        }
+
+        if (pfds[1].revents != 0)
+            return NULL;
+
+        if (pfds[0].revents & (POLLERR | POLLHUP | POLLNVAL))
+            break;
+
+        if (!(pfds[0].revents & POLLIN))
+            continue;
+
+        len = read(reader->fd, reader->buf, reader->buf_len);
+        if (len < 0) {
+            if (errno == EAGAIN || errno == EINTR)
+                continue;
+            break;
+        }
+
+        // NOTE: The batch is filtered before passing to the ring buffer, thus neither the space of
+        // ring buffer nor the wake-up of consumers is consumed for the discarded events.
+        if (len > 0)
+            len = seq_user_client_filter_events(reader->priv, reader->buf, len);
+
+        if (len > 0 && seq_event_ring_push(reader->ring, reader->buf, len)) {
+            // The counter of eventfd is just used to wake up consumers.
+            if (write(reader->notify_fd, &val, sizeof(val)) < 0)
+                continue;
+        }
+    }
+
+    // NOTE: Wake up consumers so that they can find that no batch is passed anymore.
+    g_atomic_int_set(&reader->disconnected, TRUE);
+    if (write(reader->notify_fd, &val, sizeof(val)) < 0)
+        g_warn_if_reached();
+
+    return NULL;
+}
+
+static struct seq_reader *seq_reader_ref(struct seq_reader *reader)
+{
+    g_atomic_int_inc(&reader->ref_count);
+    return reader;
+}
+
+static void seq_reader_free(struct seq_reader *reader)
+{
+    if (reader->stop_fd >= 0)
+        close(reader->stop_fd);
+    if (reader->notify_fd >= 0)
+        close(reader->notify_fd);
+    if (reader->ring != NULL)
+        seq_event_ring_free(reader->ring);
+    g_free(reader->buf);
+    g_mutex_clear(&reader->mutex);
+    g_cond_clear(&reader->cond);
+    g_free(reader);
+}
+
+// NOTE: The reader is shared by the instance, the sources, and the consumers in the call of
+// alsaseq_user_client_pop_events(). The last one releases it so that the ring buffer and the file
+// descriptor for notification are available to the others after the thread is stopped.
+static void seq_reader_unref(struct seq_reader *reader)
+{
+    if (g_atomic_int_dec_and_test(&reader->ref_count))
+        seq_reader_free(reader);
+}
+
+/**
+ * alsaseq_user_client_start_reader:
+ * @self: A [class@UserClient].
+ * @ring_size: The size of ring buffer in byte unit. It is rounded up to power of two.
+ * @priority: The priority of `SCHED_FIFO` scheduling policy for the thread. When zero, the thread
+ *            runs with the default scheduling policy.
+ * @error: A [struct@GLib.Error]. Error is generated with domain of `ALSASeq.UserClientError`.
+ *
+ * Start a thread to read events from ALSA sequencer character device. The thread blocks in the
+ * `poll(2)` system call, then executes `read(2)` system call with the buffer which size is decided
+ * by [property@UserClient:read-buffer-size]. The batch of events is passed to the ring buffer
+ * without lock, while the batch is dropped and [property@UserClient:reader-overrun-count] is
+ * incremented when the ring buffer has no space for it.
+ *
+ * The events are filtered by the thread before the batch is passed to the ring buffer. When no
+ * event remains in the batch, neither the ring buffer nor the consumers are involved.
+ *
+ * The batch of events in the ring buffer is retrieved by the call of
+ * [method@UserClient.pop_events], or by [struct@GLib.Source] returned by the call of
+ * [method@UserClient.create_reader_source]. Any consumer should run in a single thread since the
+ * ring buffer is designed for single producer and single consumer. The source returned by
+ * [method@UserClient.create_source] should not be used together.
+ *
+ * Returns: %TRUE when the overall operation finishes successfully, else %FALSE.
+ *
+ * Since: 0.4.
+ */
+gboolean alsaseq_user_client_start_reader(ALSASeqUserClient *self, guint ring_size,
+                                          gint priority, GError **error)
+{
+    ALSASeqUserClientPrivate *priv;
+    struct seq_reader *reader;
+    gsize ring_length;
+
+    g_return_val_if_fail(ALSASEQ_IS_USER_CLIENT(self), FALSE);
+    priv = alsaseq_user_client_get_instance_private(self);
+    g_return_val_if_fail(priv->fd >= 0, FALSE);
+    g_return_val_if_fail(priv->reader == NULL, FALSE);
+
+    g_return_val_if_fail(ring_size > 0 && ring_size <= G_MAXINT, FALSE);
+    g_return_val_if_fail(priority >= 0, FALSE);
+    g_return_val_if_fail(error == NULL || *error == NULL, FALSE);
+
+    reader = g_malloc0(sizeof(*reader));
+    reader->ref_count = 1;
+    reader->fd = priv->fd;
+    reader->stop_fd = -1;
+    reader->notify_fd = -1;
+    reader->priority = priority;
+    reader->priv = priv;
+    g_mutex_init(&reader->mutex);
+    g_cond_init(&reader->cond);
+
+    if (!decide_read_buffer_size(priv, &reader->buf_len, error)) {
+        seq_reader_free(reader);
+        return FALSE;
+    }
+    reader->buf = g_malloc0(reader->buf_len);
+
+    // The ring buffer should be large enough to store the batch filling the buffer for read.
+    ring_length = MAX(ring_size, reader->buf_len + sizeof(guint32));
+    if (ring_length > G_MAXINT) {
+        g_set_error(error, ALSASEQ_USER_CLIENT_ERROR, ALSASEQ_USER_CLIENT_ERROR_FAILED,
+                    "The size of ring buffer is too large: %lu", ring_length);
+        seq_reader_free(reader);
+        return FALSE;
+    }
+    reader->ring = seq_event_ring_new(ring_length);
+
+    reader->stop_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (reader->stop_fd < 0) {
+        generate_syscall_error(error, errno, "eventfd(%s)", "stop");
+        seq_reader_free(reader);
+        return FALSE;
+    }
+
+    reader->notify_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (reader->notify_fd < 0) {
+        generate_syscall_error(error, errno, "eventfd(%s)", "notify");
+        seq_reader_free(reader);
+        return FALSE;
+    }
+
+    reader->thread = g_thread_try_new("ALSASeqUserClient", seq_user_client_run_reader, reader,
+                                      error);
+    if (reader->thread == NULL) {
+        seq_reader_free(reader);
+        return FALSE;
+    }
+
+    g_mutex_lock(&reader->mutex);
+    while (!reader->started)
+        g_cond_wait(&reader->cond, &reader->mutex);
+    g_mutex_unlock(&reader->mutex);
+
+    if (reader->sched_err != 0) {
+        generate_syscall_error(error, reader->sched_err, "pthread_setschedparam(%s)",
+                               "SCHED_FIFO");
+        g_thread_join(reader->thread);
+        seq_reader_free(reader);
+        return FALSE;
+    }
+
+    g_mutex_lock(&priv->reader_lock);
+    reader->generation = ++priv->reader_generation;
+    priv->reader = reader;
+    g_mutex_unlock(&priv->reader_lock);
+
+    return TRUE;
+}
+
+/**
+ * alsaseq_user_client_stop_reader:
+ * @self: A [class@UserClient].
+ *
+ * Stop the thread started by the call of [method@UserClient.start_reader]. The batches of events
+ * remaining in the ring buffer are discarded. The sources created by the call of
+ * [method@UserClient.create_reader_source] are removed in their next dispatch.
+ *
+ * Since: 0.4.
+ */
+void alsaseq_user_client_stop_reader(ALSASeqUserClient *self)
+{
+    ALSASeqUserClientPrivate *priv;
+    struct seq_reader *reader;
+    guint64 val = 1;
+
+    g_return_if_fail(ALSASEQ_IS_USER_CLIENT(self));
+    priv = alsaseq_user_client_get_instance_private(self);
+
+    g_mutex_lock(&priv->reader_lock);
+    reader = priv->reader;
+    priv->reader = NULL;
+    g_mutex_unlock(&priv->reader_lock);
+
+    if (reader == NULL)
+        return;
+
+    if (write(reader->stop_fd, &val, sizeof(val)) < 0)
+        g_warn_if_reached();
+    g_thread_join(reader->thread);
+
+    // The sources and the consumers may still refer to the reader.
+    seq_reader_unref(reader);
+}
+
+/**
+ * alsaseq_user_client_pop_events:
+ * @self: A [class@UserClient].
+ * @ev_cntr: A [struct@EventCntr] to store the batch of events.
+ *
+ * Retrieve the batch of events from the ring buffer filled by the thread started by the call of
+ * [method@UserClient.start_reader]. The buffer of container is reused, thus the container
+ * allocated by [ctor@EventCntr.new] is preferable to avoid memory allocation. The container
+ * borrowing the buffer from the source is not available.
+ *
+ * When the thread finishes by itself since ALSA sequencer character device is not available
+ * anymore, [property@UserClient:reader-disconnected] becomes %TRUE. The remaining batches are
+ * still retrieved, then the thread should be stopped by [method@UserClient.stop_reader].
+ *
+ * Returns: %TRUE when the batch of events is retrieved, else %FALSE. %FALSE is also returned when
+ *          the thread is not running.
+ *
+ * Since: 0.4.
+ */
+gboolean alsaseq_user_client_pop_events(ALSASeqUserClient *self, ALSASeqEventCntr *ev_cntr)
+{
+    ALSASeqUserClientPrivate *priv;
+    struct seq_reader *reader;
+    gboolean result;
+
+    g_return_val_if_fail(ALSASEQ_IS_USER_CLIENT(self), FALSE);
+    priv = alsaseq_user_client_get_instance_private(self);
+
+    g_return_val_if_fail(ev_cntr != NULL, FALSE);
+    g_return_val_if_fail(ev_cntr->owned, FALSE);
+
+    // NOTE: The reader can be stopped in the other thread while the batch is retrieved.
+    g_mutex_lock(&priv->reader_lock);
+    reader = priv->reader != NULL ? seq_reader_ref(priv->reader) : NULL;
+    g_mutex_unlock(&priv->reader_lock);
+
+    if (reader == NULL)
+        return FALSE;
+
+    result = seq_event_ring_pop(reader->ring, ev_cntr);
+    seq_reader_unref(reader);
+
+    return result;
+}
+
+static gboolean seq_user_client_check_reader_src(GSource *gsrc)
+{
+    UserClientReaderSource *src = (UserClientReaderSource *)gsrc;
+    GIOCondition condition;
+
+    condition = g_source_query_unix_fd(gsrc, src->tag);
+    return !!(condition & (G_IO_IN | G_IO_ERR | G_IO_NVAL));
+}
+
+static gboolean seq_user_client_dispatch_reader_src(GSource *gsrc, GSourceFunc cb,
+                                                    gpointer user_data)
+{
+    UserClientReaderSource *src = (UserClientReaderSource *)gsrc;
+    ALSASeqUserClient *self = src->self;
+    ALSASeqUserClientPrivate *priv;
+    gboolean stopped;
+    gboolean disconnected;
+    guint64 val;
+
+    priv = alsaseq_user_client_get_instance_private(self);
+
+    // NOTE: The generation is compared instead of the file descriptor, since the number of file
+    // descriptor can be reused by the thread started later.
+    g_mutex_lock(&priv->reader_lock);
+    stopped = priv->reader == NULL || priv->reader_generation != src->reader->generation;
+    g_mutex_unlock(&priv->reader_lock);
+
+    // The thread is stopped.
+    if (stopped)
+        return G_SOURCE_REMOVE;
+
+    if (read(src->reader->notify_fd, &val, sizeof(val)) < 0 && errno != EAGAIN)
+        return G_SOURCE_REMOVE;
+
+    // NOTE: The flag is checked before retrieving batches, since the thread sets it after passing
+    // the last batch.
+    disconnected = g_atomic_int_get(&src->reader->disconnected);
+
+    // NOTE: The ring buffer is available till the source is finalized, even if the thread is
+    // stopped in the other thread.
+    // NOTE: The batches are already filtered by the thread.
+    while (seq_event_ring_pop(src->reader->ring, &src->ev_cntr))
+        seq_user_client_handle_event(self, priv, &src->ev_cntr);
+
+    // The thread finished by itself and no batch is passed anymore.
+    if (disconnected)
+        return G_SOURCE_REMOVE;
+
+    return G_SOURCE_CONTINUE;
+}
+
+static void seq_user_client_finalize_reader_src(GSource *gsrc)
+{
+    UserClientReaderSource *src = (UserClientReaderSource *)gsrc;
+
+    g_free(src->ev_cntr.buf);
+    seq_reader_unref(src->reader);
+    g_object_unref(src->self);
+}
+
+/**
+ * alsaseq_user_client_create_reader_source:
+ * @self: A [class@UserClient].
+ * @gsrc: (out): A #GSource to handle events from the ring buffer.
+ * @error: A [struct@GLib.Error].
+ *
+ * Allocate [struct@GLib.Source] structure to handle batches of events which the thread started by
+ * the call of [method@UserClient.start_reader] passes to the ring buffer. The source is available
+ * in any [struct@GLib.MainContext] to emit [signal@UserClient::handle-event] signal for each
+ * batch. The source is removed when the thread is stopped. When the thread finishes by itself as
+ * [property@UserClient:reader-disconnected], the source is removed after handling the remaining
+ * batches.
+ *
+ * Returns: %TRUE when the overall operation finishes successfully, else %FALSE.
+ *
+ * Since: 0.4.
+ */
+gboolean alsaseq_user_client_create_reader_source(ALSASeqUserClient *self, GSource **gsrc,
+                                                  GError **error)
+{
+    static GSourceFuncs funcs = {
+            .check          = seq_user_client_check_reader_src,
+            .dispatch       = seq_user_client_dispatch_reader_src,
+            .finalize       = seq_user_client_finalize_reader_src,
+    };
+    ALSASeqUserClientPrivate *priv;
+    UserClientReaderSource *src;
+    struct seq_reader *reader;
+
+    g_return_val_if_fail(ALSASEQ_IS_USER_CLIENT(self), FALSE);
+    priv = alsaseq_user_client_get_instance_private(self);
+
+    g_return_val_if_fail(gsrc != NULL, FALSE);
+    g_return_val_if_fail(error == NULL || *error == NULL, FALSE);
+
+    g_mutex_lock(&priv->reader_lock);
+    reader = priv->reader != NULL ? seq_reader_ref(priv->reader) : NULL;
+    g_mutex_unlock(&priv->reader_lock);
+
+    g_return_val_if_fail(reader != NULL, FALSE);
+
+    *gsrc = g_source_new(&funcs, sizeof(*src));
+    src = (UserClientReaderSource *)(*gsrc);
+
+    g_source_set_name(*gsrc, "ALSASeqUserClientReader");
+    g_source_set_priority(*gsrc, G_PRIORITY_HIGH_IDLE);
+    g_source_set_can_recurse(*gsrc, TRUE);
+
+    src->self = g_object_ref(self);
+    src->reader = reader;
+    src->tag = g_source_add_unix_fd(*gsrc, reader->notify_fd, G_IO_IN);
+
+    return TRUE;
+}
+
+/**
+ * alsaseq_user_client_operate_subscription:
+ * @self: A [class@UserClient].
+ * @subs_data: A [class@SubscribeData].
+ * @establish: Whether to establish subscription between two ports, or break it.
+ * @error: A [struct@GLib.Error]. Error is generated with domain of `ALSASeq.UserClientError`.
+ *
+ * Operate subscription between two ports pointed by the data.
+ *
+ * The call of function executes `ioctl(2)` system call with `SNDRV_SEQ_IOCTL_SUBSCRIBE_PORT` and
+ * `SNDRV_SEQ_IOCTL_UNSUBSCRIBE_PORT` commands for ALSA sequencer character device.
+ *
+ * Returns: %TRUE when the overall operation finishes successfully, else %FALSE.
  */
 gboolean alsaseq_user_client_operate_subscription(ALSASeqUserClient *self,
                                                   ALSASeqSubscribeData *subs_data,
@@ -1207,6 +2512,14 @@ gboolean alsaseq_user_client_get_queue_timer(ALSASeqUserClient *self, guint8 que
     return TRUE;
 }
 
+gboolean seq_user_client_get_subscription(ALSASeqUserClient *self,
+                                          struct snd_seq_port_subscribe *data)
+{
+    ALSASeqUserClientPrivate *priv = alsaseq_user_client_get_instance_private(self);
+
+    return ioctl(priv->fd, SNDRV_SEQ_IOCTL_GET_SUBSCRIPTION, data) >= 0;
+}
+
 /**
  * alsaseq_user_client_remove_events:
  * @self: A [class@UserClient].
@@ -1241,3 +2554,411 @@ gboolean alsaseq_user_client_remove_events(ALSASeqUserClient *self, ALSASeqRemov
 
     return TRUE;
 }
+
+/**
+ * alsaseq_user_client_query_system_info:
+ * @self: A [class@UserClient].
+ * @system_info: (out): The information of ALSA Sequencer.
+ * @error: A [struct@GLib.Error]. Error is generated with domain of `GLib.FileError`.
+ *
+ * Get information of ALSA Sequencer. Unlike [func@get_system_info], the file descriptor opened by
+ * the instance is used, thus the current number of clients includes the instance.
+ *
+ * The call of function executes `ioctl(2)` system call with `SNDRV_SEQ_IOCTL_SYSTEM_INFO` command
+ * for ALSA sequencer character device.
+ *
+ * Returns: %TRUE when the overall operation finishes successfully, else %FALSE.
+ *
+ * Since: 0.4.
+ */
+gboolean alsaseq_user_client_query_system_info(ALSASeqUserClient *self,
+                                               ALSASeqSystemInfo **system_info, GError **error)
+{
+    ALSASeqUserClientPrivate *priv;
+
+    g_return_val_if_fail(ALSASEQ_IS_USER_CLIENT(self), FALSE);
+    priv = alsaseq_user_client_get_instance_private(self);
+    g_return_val_if_fail(priv->fd >= 0, FALSE);
+
+    g_return_val_if_fail(system_info != NULL, FALSE);
+    g_return_val_if_fail(error == NULL || *error == NULL, FALSE);
+
+    return seq_query_system_info(priv->fd, system_info, error);
+}
+
+/**
+ * alsaseq_user_client_query_client_id_list:
+ * @self: A [class@UserClient].
+ * @entries: (array length=entry_count)(out): The array with elements for numeric identified of
+ *           client. One of [enum@SpecificClientId] can be included in result as well as any
+ *           numeric value.
+ * @entry_count: The number of entries.
+ * @error: A [struct@GLib.Error]. Error is generated with domain of `GLib.FileError`.
+ *
+ * Get the list of clients as the numeric identifier. Unlike [func@get_client_id_list], the
+ * file descriptor opened by the instance is used, thus the list includes the instance.
+ *
+ * The call of function executes `ioctl(2)` system call with `SNDRV_SEQ_IOCTL_CLIENT_ID`,
+ * `SNDRV_SEQ_IOCTL_SYSTEM_INFO`, and `SNDRV_SEQ_IOCTL_QUERY_NEXT_CLIENT` command for ALSA
+ * sequencer character device.
+ *
+ * Returns: %TRUE when the overall operation finishes successfully, else %FALSE.
+ *
+ * Since: 0.4.
+ */
+gboolean alsaseq_user_client_query_client_id_list(ALSASeqUserClient *self, guint8 **entries,
+                                                  gsize *entry_count, GError **error)
+{
+    ALSASeqUserClientPrivate *priv;
+
+    g_return_val_if_fail(ALSASEQ_IS_USER_CLIENT(self), FALSE);
+    priv = alsaseq_user_client_get_instance_private(self);
+    g_return_val_if_fail(priv->fd >= 0, FALSE);
+
+    g_return_val_if_fail(entries != NULL, FALSE);
+    g_return_val_if_fail(entry_count != NULL, FALSE);
+    g_return_val_if_fail(error == NULL || *error == NULL, FALSE);
+
+    return seq_query_client_id_list(priv->fd, FALSE, entries, entry_count, error);
+}
+
+/**
+ * alsaseq_user_client_query_client_info:
+ * @self: A [class@UserClient].
+ * @client_id: The numeric identifier of client to query. One of [enum@SpecificClientId] is
+ *             available as well as any numeric value.
+ * @client_info: (out): A [class@ClientInfo] for the client.
+ * @error: A [struct@GLib.Error]. Error is generated with domain of `GLib.FileError`.
+ *
+ * Get the information of client according to the numeric ID, by the file descriptor opened by the
+ * instance.
+ *
+ * The call of function executes `ioctl(2)` system call with `SNDRV_SEQ_IOCTL_GET_CLIENT_INFO`
+ * command for ALSA sequencer character device.
+ *
+ * Returns: %TRUE when the overall operation finishes successfully, else %FALSE.
+ *
+ * Since: 0.4.
+ */
+gboolean alsaseq_user_client_query_client_info(ALSASeqUserClient *self, guint8 client_id,
+                                               ALSASeqClientInfo **client_info, GError **error)
+{
+    ALSASeqUserClientPrivate *priv;
+
+    g_return_val_if_fail(ALSASEQ_IS_USER_CLIENT(self), FALSE);
+    priv = alsaseq_user_client_get_instance_private(self);
+    g_return_val_if_fail(priv->fd >= 0, FALSE);
+
+    g_return_val_if_fail(client_info != NULL, FALSE);
+    g_return_val_if_fail(error == NULL || *error == NULL, FALSE);
+
+    return seq_query_client_info(priv->fd, client_id, client_info, error);
+}
+
+/**
+ * alsaseq_user_client_query_port_id_list:
+ * @self: A [class@UserClient].
+ * @client_id: The numeric ID of client to query. One of [enum@SpecificClientId] is available as
+ *             well as any numeric value.
+ * @entries: (array length=entry_count)(out): The array with elements for numeric identifier of
+ *           port. One of [enum@SpecificPortId] is available as well as any numeric value.
+ * @entry_count: The number of entries in the array.
+ * @error: A [struct@GLib.Error]. Error is generated with domain of `GLib.FileError`.
+ *
+ * Get the list of numeric identifiers for port added by the client, by the file descriptor opened
+ * by the instance.
+ *
+ * The call of function executes `ioctl(2)` system call with `SNDRV_SEQ_IOCTL_GET_CLIENT_INFO` and
+ * `SNDRV_SEQ_IOCTL_QUERY_NEXT_PORT` commands for ALSA sequencer character device.
+ *
+ * Returns: %TRUE when the overall operation finishes successfully, else %FALSE.
+ *
+ * Since: 0.4.
+ */
+gboolean alsaseq_user_client_query_port_id_list(ALSASeqUserClient *self, guint8 client_id,
+                                                guint8 **entries, gsize *entry_count,
+                                                GError **error)
+{
+    ALSASeqUserClientPrivate *priv;
+
+    g_return_val_if_fail(ALSASEQ_IS_USER_CLIENT(self), FALSE);
+    priv = alsaseq_user_client_get_instance_private(self);
+    g_return_val_if_fail(priv->fd >= 0, FALSE);
+
+    g_return_val_if_fail(entries != NULL, FALSE);
+    g_return_val_if_fail(entry_count != NULL, FALSE);
+    g_return_val_if_fail(error == NULL || *error == NULL, FALSE);
+
+    return seq_query_port_id_list(priv->fd, client_id, entries, entry_count, error);
+}
+
+/**
+ * alsaseq_user_client_query_port_info:
+ * @self: A [class@UserClient].
+ * @client_id: The numeric identifier of client to query. One of [enum@SpecificClientId] is
+ *             available as well as any numerica value.
+ * @port_id: The numeric identifier of port in the client. One of [enum@SpecificPortId] is
+ *           available as well as any numeric value.
+ * @port_info: (out): A [class@PortInfo] for the port.
+ * @error: A [struct@GLib.Error]. Error is generated with domain of `GLib.FileError`.
+ *
+ * Get the information of port in client, by the file descriptor opened by the instance.
+ *
+ * The call of function executes `ioctl(2)` system call with `SNDRV_SEQ_IOCTL_GET_PORT_INFO`
+ * command for ALSA sequencer character device.
+ *
+ * Returns: %TRUE when the overall operation finishes successfully, else %FALSE.
+ *
+ * Since: 0.4.
+ */
+gboolean alsaseq_user_client_query_port_info(ALSASeqUserClient *self, guint8 client_id,
+                                             guint8 port_id, ALSASeqPortInfo **port_info,
+                                             GError **error)
+{
+    ALSASeqUserClientPrivate *priv;
+
+    g_return_val_if_fail(ALSASEQ_IS_USER_CLIENT(self), FALSE);
+    priv = alsaseq_user_client_get_instance_private(self);
+    g_return_val_if_fail(priv->fd >= 0, FALSE);
+
+    g_return_val_if_fail(port_info != NULL, FALSE);
+    g_return_val_if_fail(error == NULL || *error == NULL, FALSE);
+
+    return seq_query_port_info(priv->fd, client_id, port_id, port_info, error);
+}
+
+/**
+ * alsaseq_user_client_query_client_pool:
+ * @self: A [class@UserClient].
+ * @client_id: The numeric ID of client to query. One of [enum@SpecificClientId] is available as
+ *             well as any numeric value.
+ * @client_pool: (out): The information of memory pool for the client.
+ * @error: A [struct@GLib.Error]. Error is generated with domain of `GLib.FileError`.
+ *
+ * Get statistical information of memory pool for the given client, by the file descriptor opened
+ * by the instance.
+ *
+ * The call of function executes `ioctl(2)` system call with `SNDRV_SEQ_IOCTL_GET_CLIENT_POOL`
+ * command for ALSA sequencer character device.
+ *
+ * Returns: %TRUE when the overall operation finishes successfully, else %FALSE.
+ *
+ * Since: 0.4.
+ */
+gboolean alsaseq_user_client_query_client_pool(ALSASeqUserClient *self, guint8 client_id,
+                                               ALSASeqClientPool **client_pool, GError **error)
+{
+    ALSASeqUserClientPrivate *priv;
+
+    g_return_val_if_fail(ALSASEQ_IS_USER_CLIENT(self), FALSE);
+    priv = alsaseq_user_client_get_instance_private(self);
+    g_return_val_if_fail(priv->fd >= 0, FALSE);
+
+    g_return_val_if_fail(client_pool != NULL, FALSE);
+    g_return_val_if_fail(error == NULL || *error == NULL, FALSE);
+
+    return seq_query_client_pool(priv->fd, client_id, client_pool, error);
+}
+
+/**
+ * alsaseq_user_client_query_subscription_list:
+ * @self: A [class@UserClient].
+ * @addr: A [struct@Addr] to query.
+ * @query_type: The type of query, one of [enum@QuerySubscribeType].
+ * @entries: (element-type ALSASeq.SubscribeData)(out): The array with element for subscription
+ *           data.
+ * @error: A [struct@GLib.Error]. Error is generated with domain of `GLib.FileError`.
+ *
+ * Get the list of subscription for given address and query type, by the file descriptor opened by
+ * the instance.
+ *
+ * The list is empty when the address has no subscription.
+ *
+ * The call of function executes `ioctl(2)` system call with `SNDRV_SEQ_IOCTL_QUERY_SUBS` command
+ * for ALSA sequencer character device.
+ *
+ * Returns: %TRUE when the overall operation finishes successfully, else %FALSE.
+ *
+ * Since: 0.4.
+ */
+gboolean alsaseq_user_client_query_subscription_list(ALSASeqUserClient *self,
+                                                     const ALSASeqAddr *addr,
+                                                     ALSASeqQuerySubscribeType query_type,
+                                                     GList **entries, GError **error)
+{
+    ALSASeqUserClientPrivate *priv;
+
+    g_return_val_if_fail(ALSASEQ_IS_USER_CLIENT(self), FALSE);
+    priv = alsaseq_user_client_get_instance_private(self);
+    g_return_val_if_fail(priv->fd >= 0, FALSE);
+
+    g_return_val_if_fail(addr != NULL, FALSE);
+    g_return_val_if_fail(entries != NULL, FALSE);
+    g_return_val_if_fail(error == NULL || *error == NULL, FALSE);
+
+    return seq_query_subscription_list(priv->fd, addr, query_type, entries, error);
+}
+
+/**
+ * alsaseq_user_client_query_queue_id_list:
+ * @self: A [class@UserClient].
+ * @entries: (array length=entry_count)(out): The array of elements for numeric identifier of queue.
+ * @entry_count: The number of entries.
+ * @error: A [struct@GLib.Error]. Error is generated with domain of `GLib.FileError`.
+ *
+ * Get the list of queue in ALSA Sequencer, by the file descriptor opened by the instance.
+ *
+ * The call of function executes `ioctl(2)` system call with `SNDRV_SEQ_IOCTL_SYSTEM_INFO` and
+ * `SNDRV_SEQ_IOCTL_GET_QUEUE_INFO` commands for ALSA sequencer character device.
+ *
+ * Returns: %TRUE when the overall operation finishes successfully, else %FALSE.
+ *
+ * Since: 0.4.
+ */
+gboolean alsaseq_user_client_query_queue_id_list(ALSASeqUserClient *self, guint8 **entries,
+                                                 gsize *entry_count, GError **error)
+{
+    ALSASeqUserClientPrivate *priv;
+
+    g_return_val_if_fail(ALSASEQ_IS_USER_CLIENT(self), FALSE);
+    priv = alsaseq_user_client_get_instance_private(self);
+    g_return_val_if_fail(priv->fd >= 0, FALSE);
+
+    g_return_val_if_fail(entries != NULL, FALSE);
+    g_return_val_if_fail(entry_count != NULL, FALSE);
+    g_return_val_if_fail(error == NULL || *error == NULL, FALSE);
+
+    return seq_query_queue_id_list(priv->fd, entries, entry_count, error);
+}
+
+/**
+ * alsaseq_user_client_query_queue_info_by_id:
+ * @self: A [class@UserClient].
+ * @queue_id: The numeric ID of queue. One of [enum@SpecificQueueId] is available as well.
+ * @queue_info: (out): The information of queue.
+ * @error: A [struct@GLib.Error]. Error is generated with domain of `GLib.FileError`.
+ *
+ * Get the information of queue, according to the numeric ID, by the file descriptor opened by the
+ * instance.
+ *
+ * The call of function executes `ioctl(2)` system call with `SNDRV_SEQ_IOCTL_GET_QUEUE_INFO`
+ * command for ALSA sequencer character device.
+ *
+ * Returns: %TRUE when the overall operation finishes successfully, else %FALSE.
+ *
+ * Since: 0.4.
+ */
+gboolean alsaseq_user_client_query_queue_info_by_id(ALSASeqUserClient *self, guint8 queue_id,
+                                                    ALSASeqQueueInfo **queue_info, GError **error)
+{
+    ALSASeqUserClientPrivate *priv;
+
+    g_return_val_if_fail(ALSASEQ_IS_USER_CLIENT(self), FALSE);
+    priv = alsaseq_user_client_get_instance_private(self);
+    g_return_val_if_fail(priv->fd >= 0, FALSE);
+
+    g_return_val_if_fail(queue_info != NULL, FALSE);
+    g_return_val_if_fail(error == NULL || *error == NULL, FALSE);
+
+    return seq_query_queue_info_by_id(priv->fd, queue_id, queue_info, error);
+}
+
+/**
+ * alsaseq_user_client_query_queue_info_by_name:
+ * @self: A [class@UserClient].
+ * @name: The name string of queue to query.
+ * @queue_info: (out): The information of queue.
+ * @error: A [struct@GLib.Error]. Error is generated with domain of `GLib.FileError`.
+ *
+ * Get the information of queue, according to the name string, by the file descriptor opened by
+ * the instance.
+ *
+ * The call of function executes `ioctl(2)` system call with `SNDRV_SEQ_IOCTL_GET_NAMED_QUEUE`
+ * command for ALSA sequencer character device.
+ *
+ * Returns: %TRUE when the overall operation finishes successfully, else %FALSE.
+ *
+ * Since: 0.4.
+ */
+gboolean alsaseq_user_client_query_queue_info_by_name(ALSASeqUserClient *self, const gchar *name,
+                                                      ALSASeqQueueInfo **queue_info,
+                                                      GError **error)
+{
+    ALSASeqUserClientPrivate *priv;
+
+    g_return_val_if_fail(ALSASEQ_IS_USER_CLIENT(self), FALSE);
+    priv = alsaseq_user_client_get_instance_private(self);
+    g_return_val_if_fail(priv->fd >= 0, FALSE);
+
+    g_return_val_if_fail(name != NULL, FALSE);
+    g_return_val_if_fail(queue_info != NULL, FALSE);
+    g_return_val_if_fail(error == NULL || *error == NULL, FALSE);
+
+    return seq_query_queue_info_by_name(priv->fd, name, queue_info, error);
+}
+
+/**
+ * alsaseq_user_client_query_queue_status:
+ * @self: A [class@UserClient].
+ * @queue_id: The numeric ID of queue. One of [enum@SpecificQueueId] is available as well.
+ * @queue_status: (inout): The current status of queue.
+ * @error: A [struct@GLib.Error]. Error is generated with domain of `GLib.FileError`.
+ *
+ * Get current status of queue, by the file descriptor opened by the instance.
+ *
+ * The call of function executes `ioctl(2)` system call with `SNDRV_SEQ_IOCTL_GET_QUEUE_STATUS`
+ * command for ALSA sequencer character device.
+ *
+ * Returns: %TRUE when the overall operation finishes successfully, else %FALSE.
+ *
+ * Since: 0.4.
+ */
+gboolean alsaseq_user_client_query_queue_status(ALSASeqUserClient *self, guint8 queue_id,
+                                                ALSASeqQueueStatus *const *queue_status,
+                                                GError **error)
+{
+    ALSASeqUserClientPrivate *priv;
+
+    g_return_val_if_fail(ALSASEQ_IS_USER_CLIENT(self), FALSE);
+    priv = alsaseq_user_client_get_instance_private(self);
+    g_return_val_if_fail(priv->fd >= 0, FALSE);
+
+    g_return_val_if_fail(queue_status != NULL, FALSE);
+    g_return_val_if_fail(ALSASEQ_IS_QUEUE_STATUS(*queue_status), FALSE);
+    g_return_val_if_fail(error == NULL || *error == NULL, FALSE);
+
+    return seq_query_queue_status(priv->fd, queue_id, *queue_status, error);
+}
+
+/**
+ * alsaseq_user_client_query_graph_snapshot:
+ * @self: A [class@UserClient].
+ * @snapshot: (out): The snapshot of clients, ports, and subscriptions.
+ * @error: A [struct@GLib.Error]. Error is generated with domain of `GLib.FileError`.
+ *
+ * Get the snapshot of all clients, ports, and subscriptions in ALSA Sequencer at once, by the file
+ * descriptor opened by the instance. The instance itself is included in the snapshot.
+ *
+ * The call of function executes `ioctl(2)` system call with `SNDRV_SEQ_IOCTL_CLIENT_ID`,
+ * `SNDRV_SEQ_IOCTL_QUERY_NEXT_CLIENT`, `SNDRV_SEQ_IOCTL_QUERY_NEXT_PORT`, and
+ * `SNDRV_SEQ_IOCTL_QUERY_SUBS` commands for ALSA sequencer character device.
+ *
+ * Returns: %TRUE when the overall operation finishes successfully, else %FALSE.
+ *
+ * Since: 0.4.
+ */
+gboolean alsaseq_user_client_query_graph_snapshot(ALSASeqUserClient *self,
+                                                  ALSASeqGraphSnapshot **snapshot,
+                                                  GError **error)
+{
+    ALSASeqUserClientPrivate *priv;
+
+    g_return_val_if_fail(ALSASEQ_IS_USER_CLIENT(self), FALSE);
+    priv = alsaseq_user_client_get_instance_private(self);
+    g_return_val_if_fail(priv->fd >= 0, FALSE);
+
+    g_return_val_if_fail(snapshot != NULL, FALSE);
+    g_return_val_if_fail(error == NULL || *error == NULL, FALSE);
+
+    return seq_query_graph_snapshot(priv->fd, FALSE, snapshot, error);
+}
@@ -14,6 +14,22 @@ G_DECLARE_DERIVABLE_TYPE(ALSASeqUserClient, alsaseq_user_client, ALSASEQ, USER_C
 
 GQuark alsaseq_user_client_error_quark();
 
+/**
+ * ALSASeqUserClientEventHandler:
+ * @self: A [class@UserClient].
+ * @ev_cntr: (transfer none): The instance of [struct@EventCntr] which includes batch of events.
+ * @user_data: The data passed to [method@UserClient.set_event_handler].
+ *
+ * The type of function to handle batch of events. The buffer of container is borrowed from the
+ * source, thus it is not available after the function returns. The container is available for
+ * [method@EventCntrIter.init] to refer to the events without copy.
+ *
+ * Since: 0.4.
+ */
+typedef void (*ALSASeqUserClientEventHandler)(ALSASeqUserClient *self,
+                                              ALSASeqEventCntr *ev_cntr,
+                                              gpointer user_data);
+
 struct _ALSASeqUserClientClass {
     GObjectClass parent_class;
 
@@ -62,9 +78,31 @@ gboolean alsaseq_user_client_schedule_event(ALSASeqUserClient *self, const ALSAS
                                             GError **error);
 gboolean alsaseq_user_client_schedule_events(ALSASeqUserClient *self, const GList *events,
                                              gsize *count, GError **error);
+gboolean alsaseq_user_client_schedule_event_cntr(ALSASeqUserClient *self,
+                                                 const ALSASeqEventCntr *ev_cntr, gsize *count,
+                                                 GError **error);
 
 gboolean alsaseq_user_client_create_source(ALSASeqUserClient *self, GSource **gsrc, GError **error);
 
+gboolean alsaseq_user_client_start_reader(ALSASeqUserClient *self, guint ring_size,
+                                          gint priority, GError **error);
+void alsaseq_user_client_stop_reader(ALSASeqUserClient *self);
+gboolean alsaseq_user_client_pop_events(ALSASeqUserClient *self, ALSASeqEventCntr *ev_cntr);
+gboolean alsaseq_user_client_create_reader_source(ALSASeqUserClient *self, GSource **gsrc,
+                                                  GError **error);
+
+void alsaseq_user_client_set_event_handler(ALSASeqUserClient *self,
+                                           ALSASeqUserClientEventHandler handler,
+                                           gpointer user_data, GDestroyNotify destroy);
+
+gboolean alsaseq_user_client_set_event_type_filter(ALSASeqUserClient *self,
+                                                   const ALSASeqEventType *event_types,
+                                                   gsize event_type_count, GError **error);
+void alsaseq_user_client_add_source_filter(ALSASeqUserClient *self, guint8 client_id,
+                                           guint8 port_id_min, guint8 port_id_max);
+void alsaseq_user_client_set_channel_filter(ALSASeqUserClient *self, guint16 channel_mask);
+gboolean alsaseq_user_client_clear_event_filters(ALSASeqUserClient *self, GError **error);
+
 gboolean alsaseq_user_client_operate_subscription(ALSASeqUserClient *self,
                                                   ALSASeqSubscribeData *subs_data,
                                                   gboolean establish, GError **error);
@@ -93,6 +131,38 @@ gboolean alsaseq_user_client_get_queue_timer(ALSASeqUserClient *self, guint8 que
 gboolean alsaseq_user_client_remove_events(ALSASeqUserClient *self, ALSASeqRemoveFilter *filter,
                                            GError **error);
 
+gboolean alsaseq_user_client_query_system_info(ALSASeqUserClient *self,
+                                               ALSASeqSystemInfo **system_info, GError **error);
+gboolean alsaseq_user_client_query_client_id_list(ALSASeqUserClient *self, guint8 **entries,
+                                                  gsize *entry_count, GError **error);
+gboolean alsaseq_user_client_query_client_info(ALSASeqUserClient *self, guint8 client_id,
+                                               ALSASeqClientInfo **client_info, GError **error);
+gboolean alsaseq_user_client_query_port_id_list(ALSASeqUserClient *self, guint8 client_id,
+                                                guint8 **entries, gsize *entry_count,
+                                                GError **error);
+gboolean alsaseq_user_client_query_port_info(ALSASeqUserClient *self, guint8 client_id,
+                                             guint8 port_id, ALSASeqPortInfo **port_info,
+                                             GError **error);
+gboolean alsaseq_user_client_query_client_pool(ALSASeqUserClient *self, guint8 client_id,
+                                               ALSASeqClientPool **client_pool, GError **error);
+gboolean alsaseq_user_client_query_subscription_list(ALSASeqUserClient *self,
+                                                     const ALSASeqAddr *addr,
+                                                     ALSASeqQuerySubscribeType query_type,
+                                                     GList **entries, GError **error);
+gboolean alsaseq_user_client_query_queue_id_list(ALSASeqUserClient *self, guint8 **entries,
+                                                 gsize *entry_count, GError **error);
+gboolean alsaseq_user_client_query_queue_info_by_id(ALSASeqUserClient *self, guint8 queue_id,
+                                                    ALSASeqQueueInfo **queue_info, GError **error);
+gboolean alsaseq_user_client_query_queue_info_by_name(ALSASeqUserClient *self, const gchar *name,
+                                                      ALSASeqQueueInfo **queue_info,
+                                                      GError **error);
+gboolean alsaseq_user_client_query_queue_status(ALSASeqUserClient *self, guint8 queue_id,
+                                                ALSASeqQueueStatus *const *queue_status,
+                                                GError **error);
+gboolean alsaseq_user_client_query_graph_snapshot(ALSASeqUserClient *self,
+                                                  ALSASeqGraphSnapshot **snapshot,
+                                                  GError **error);
+
 G_END_DECLS
 
 #endif
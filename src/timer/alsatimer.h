@@ -20,8 +20,10 @@
 #include <instance-info.h>
 #include <instance-params.h>
 #include <instance-status.h>
+#include <event-statistics.h>
 
 #include <user-instance.h>
+#include <multiplexer.h>
 
 #include <query.h>
 
@@ -0,0 +1,277 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+#include "privates.h"
+
+/**
+ * ALSATimerEventStatistics:
+ * A GObject-derived object to express statistics of real time events.
+ *
+ * A [class@EventStatistics] is a GObject-derived object to express statistics of real time events
+ * handled by user instance. The call of [method@UserInstance.get_event_statistics] fills the
+ * instance of object.
+ *
+ * The statistics consist of two histograms. One is for the deviation of interval between two
+ * successive tick events against the expected one; the number of ticks in the latter event
+ * multiplied by the resolution of timer. The interval is not measured across the start, stop and
+ * continue of timer. Another is for the delay between the timestamp of event and the time to
+ * receive it in user space. Each bin of histogram has the range in power of two nanoseconds,
+ * retrieved by [method@EventStatistics.get_bin_range].
+ *
+ * Since: 0.4.
+ */
+typedef struct {
+    struct timer_event_statistics stats;
+    guint overrun;
+    guint lost;
+} ALSATimerEventStatisticsPrivate;
+G_DEFINE_TYPE_WITH_PRIVATE(ALSATimerEventStatistics, alsatimer_event_statistics, G_TYPE_OBJECT)
+
+enum timer_event_statistics_props {
+    TIMER_EVENT_STATISTICS_PROP_EVENT_COUNT = 1,
+    TIMER_EVENT_STATISTICS_PROP_TICK_COUNT,
+    TIMER_EVENT_STATISTICS_PROP_EXPECTED_INTERVAL,
+    TIMER_EVENT_STATISTICS_PROP_OVERRUN,
+    TIMER_EVENT_STATISTICS_PROP_LOST,
+    TIMER_EVENT_STATISTICS_PROP_COUNT,
+};
+static GParamSpec *timer_event_statistics_props[TIMER_EVENT_STATISTICS_PROP_COUNT] = { NULL, };
+
+static void timer_event_statistics_get_property(GObject *obj, guint id,
+                                                GValue *val, GParamSpec *spec)
+{
+    ALSATimerEventStatistics *self = ALSATIMER_EVENT_STATISTICS(obj);
+    ALSATimerEventStatisticsPrivate *priv =
+                           alsatimer_event_statistics_get_instance_private(self);
+
+    switch (id) {
+    case TIMER_EVENT_STATISTICS_PROP_EVENT_COUNT:
+        g_value_set_uint(val, priv->stats.event_count);
+        break;
+    case TIMER_EVENT_STATISTICS_PROP_TICK_COUNT:
+        g_value_set_uint(val, priv->stats.tick_count);
+        break;
+    case TIMER_EVENT_STATISTICS_PROP_EXPECTED_INTERVAL:
+        g_value_set_uint64(val, priv->stats.expected_interval);
+        break;
+    case TIMER_EVENT_STATISTICS_PROP_OVERRUN:
+        g_value_set_uint(val, priv->overrun);
+        break;
+    case TIMER_EVENT_STATISTICS_PROP_LOST:
+        g_value_set_uint(val, priv->lost);
+        break;
+    default:
+        G_OBJECT_WARN_INVALID_PROPERTY_ID(obj, id, spec);
+        break;
+    }
+}
+
+static void alsatimer_event_statistics_class_init(ALSATimerEventStatisticsClass *klass)
+{
+    GObjectClass *gobject_class = G_OBJECT_CLASS(klass);
+
+    gobject_class->get_property = timer_event_statistics_get_property;
+
+    /**
+     * ALSATimerEventStatistics:event-count:
+     *
+     * The count of real time events.
+     *
+     * Since: 0.4.
+     */
+    timer_event_statistics_props[TIMER_EVENT_STATISTICS_PROP_EVENT_COUNT] =
+        g_param_spec_uint("event-count", "event-count",
+                          "The count of real time events.",
+                          0, G_MAXUINT,
+                          0,
+                          G_PARAM_READABLE);
+
+    /**
+     * ALSATimerEventStatistics:tick-count:
+     *
+     * The count of real time events for tick.
+     *
+     * Since: 0.4.
+     */
+    timer_event_statistics_props[TIMER_EVENT_STATISTICS_PROP_TICK_COUNT] =
+        g_param_spec_uint("tick-count", "tick-count",
+                          "The count of real time events for tick.",
+                          0, G_MAXUINT,
+                          0,
+                          G_PARAM_READABLE);
+
+    /**
+     * ALSATimerEventStatistics:expected-interval:
+     *
+     * The interval in nano second expected by the parameters of instance. Zero when the parameters
+     * are not configured yet by [method@UserInstance.set_params].
+     *
+     * Since: 0.4.
+     */
+    timer_event_statistics_props[TIMER_EVENT_STATISTICS_PROP_EXPECTED_INTERVAL] =
+        g_param_spec_uint64("expected-interval", "expected-interval",
+                            "The interval in nano second expected by the parameters of instance.",
+                            0, G_MAXUINT64,
+                            0,
+                            G_PARAM_READABLE);
+
+    /**
+     * ALSATimerEventStatistics:overrun:
+     *
+     * The count of overrun in read queue.
+     *
+     * Since: 0.4.
+     */
+    timer_event_statistics_props[TIMER_EVENT_STATISTICS_PROP_OVERRUN] =
+        g_param_spec_uint("overrun", "overrun",
+                          "The count of overrun in read queue.",
+                          0, G_MAXUINT,
+                          0,
+                          G_PARAM_READABLE);
+
+    /**
+     * ALSATimerEventStatistics:lost:
+     *
+     * The count of losts master ticks.
+     *
+     * Since: 0.4.
+     */
+    timer_event_statistics_props[TIMER_EVENT_STATISTICS_PROP_LOST] =
+        g_param_spec_uint("lost", "lost",
+                          "The count of losts master ticks.",
+                          0, G_MAXUINT,
+                          0,
+                          G_PARAM_READABLE);
+
+    g_object_class_install_properties(gobject_class,
+                                      TIMER_EVENT_STATISTICS_PROP_COUNT,
+                                      timer_event_statistics_props);
+}
+
+static void alsatimer_event_statistics_init(ALSATimerEventStatistics *self)
+{
+    return;
+}
+
+/**
+ * alsatimer_event_statistics_new:
+ *
+ * Allocate and return an instance of [class@EventStatistics].
+ *
+ * Returns: A [class@EventStatistics].
+ *
+ * Since: 0.4.
+ */
+ALSATimerEventStatistics *alsatimer_event_statistics_new()
+{
+    return g_object_new(ALSATIMER_TYPE_EVENT_STATISTICS, NULL);
+}
+
+/**
+ * alsatimer_event_statistics_get_interval_deviation_histogram:
+ * @self: A [class@EventStatistics].
+ * @bins: (array length=bin_count)(out)(transfer none): The array of counts for the absolute
+ *        difference between the interval of two successive tick events and the interval expected
+ *        by the number of ticks in the latter event.
+ * @bin_count: The number of bins in the array.
+ *
+ * Get histogram of deviation of interval between two successive tick events.
+ *
+ * Since: 0.4.
+ */
+void alsatimer_event_statistics_get_interval_deviation_histogram(ALSATimerEventStatistics *self,
+                                                                 const guint **bins,
+                                                                 gsize *bin_count)
+{
+    ALSATimerEventStatisticsPrivate *priv;
+
+    g_return_if_fail(ALSATIMER_IS_EVENT_STATISTICS(self));
+    priv = alsatimer_event_statistics_get_instance_private(self);
+
+    g_return_if_fail(bins != NULL);
+    g_return_if_fail(bin_count != NULL);
+
+    *bins = priv->stats.interval_deviation_bins;
+    *bin_count = G_N_ELEMENTS(priv->stats.interval_deviation_bins);
+}
+
+/**
+ * alsatimer_event_statistics_get_wakeup_delay_histogram:
+ * @self: A [class@EventStatistics].
+ * @bins: (array length=bin_count)(out)(transfer none): The array of counts for the delay between
+ *        the timestamp of event and the time to receive it in user space.
+ * @bin_count: The number of bins in the array.
+ *
+ * Get histogram of delay to wake up for events.
+ *
+ * Since: 0.4.
+ */
+void alsatimer_event_statistics_get_wakeup_delay_histogram(ALSATimerEventStatistics *self,
+                                                           const guint **bins, gsize *bin_count)
+{
+    ALSATimerEventStatisticsPrivate *priv;
+
+    g_return_if_fail(ALSATIMER_IS_EVENT_STATISTICS(self));
+    priv = alsatimer_event_statistics_get_instance_private(self);
+
+    g_return_if_fail(bins != NULL);
+    g_return_if_fail(bin_count != NULL);
+
+    *bins = priv->stats.wakeup_delay_bins;
+    *bin_count = G_N_ELEMENTS(priv->stats.wakeup_delay_bins);
+}
+
+/**
+ * alsatimer_event_statistics_get_bin_range:
+ * @self: A [class@EventStatistics].
+ * @bin: The index of bin in histogram.
+ * @lower: (out): The lower bound of range in nano second, inclusive.
+ * @upper: (out): The upper bound of range in nano second, exclusive. %G_MAXUINT64 for the last
+ *         bin.
+ *
+ * Get the range of value counted in the bin of histogram. The first bin is for zero, and the
+ * bin at index n is for the range from 2^(n-1) to 2^n nano seconds. The last bin is for any value
+ * larger than the range of previous bin.
+ *
+ * Since: 0.4.
+ */
+void alsatimer_event_statistics_get_bin_range(ALSATimerEventStatistics *self, guint bin,
+                                              guint64 *lower, guint64 *upper)
+{
+    g_return_if_fail(ALSATIMER_IS_EVENT_STATISTICS(self));
+    g_return_if_fail(bin < TIMER_EVENT_STATISTICS_BIN_COUNT);
+    g_return_if_fail(lower != NULL);
+    g_return_if_fail(upper != NULL);
+
+    if (bin == 0) {
+        *lower = 0;
+        *upper = 1;
+    } else {
+        *lower = G_GUINT64_CONSTANT(1) << (bin - 1);
+        if (bin < TIMER_EVENT_STATISTICS_BIN_COUNT - 1)
+            *upper = G_GUINT64_CONSTANT(1) << bin;
+        else
+            *upper = G_MAXUINT64;
+    }
+}
+
+void timer_event_statistics_refer_private(ALSATimerEventStatistics *self,
+                                          struct timer_event_statistics **stats,
+                                          guint **overrun, guint **lost)
+{
+    ALSATimerEventStatisticsPrivate *priv =
+                        alsatimer_event_statistics_get_instance_private(self);
+
+    *stats = &priv->stats;
+    *overrun = &priv->overrun;
+    *lost = &priv->lost;
+}
+
+guint timer_event_statistics_bin_index(guint64 val)
+{
+    // The index is the number of bits to express the value, saturated at the last bin.
+    if (val == 0)
+        return 0;
+    else if (val >= G_GUINT64_CONSTANT(1) << (TIMER_EVENT_STATISTICS_BIN_COUNT - 2))
+        return TIMER_EVENT_STATISTICS_BIN_COUNT - 1;
+    else
+        return g_bit_storage((gulong)val);
+}
@@ -0,0 +1,32 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+#ifndef __ALSA_GOBJECT_ALSATIMER_EVENT_STATISTICS_H__
+#define __ALSA_GOBJECT_ALSATIMER_EVENT_STATISTICS_H__
+
+#include <alsatimer.h>
+
+G_BEGIN_DECLS
+
+#define ALSATIMER_TYPE_EVENT_STATISTICS (alsatimer_event_statistics_get_type())
+
+G_DECLARE_DERIVABLE_TYPE(ALSATimerEventStatistics, alsatimer_event_statistics, ALSATIMER,
+                         EVENT_STATISTICS, GObject);
+
+struct _ALSATimerEventStatisticsClass {
+    GObjectClass parent_class;
+};
+
+ALSATimerEventStatistics *alsatimer_event_statistics_new();
+
+void alsatimer_event_statistics_get_interval_deviation_histogram(ALSATimerEventStatistics *self,
+                                                                 const guint **bins,
+                                                                 gsize *bin_count);
+
+void alsatimer_event_statistics_get_wakeup_delay_histogram(ALSATimerEventStatistics *self,
+                                                           const guint **bins, gsize *bin_count);
+
+void alsatimer_event_statistics_get_bin_range(ALSATimerEventStatistics *self, guint bin,
+                                              guint64 *lower, guint64 *upper);
+
+G_END_DECLS
+
+#endif
@@ -0,0 +1,479 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+#include "privates.h"
+
+/**
+ * ALSATimerMultiplexer:
+ * An object to dispatch virtual timers derived from one user instance.
+ *
+ * A [class@Multiplexer] maintains virtual timers which expire in the multiple of ticks delivered
+ * to one [class@UserInstance]. The call of [method@Multiplexer.attach] attaches the user instance
+ * to timer device, then the count of ticks is accumulated by the events of the instance. Each
+ * virtual timer added by [method@Multiplexer.add_timer] has the divider and the phase in unit of
+ * tick, and expires when the count of ticks modulo the divider equals to the phase. The expiration
+ * is notified by [signal@Multiplexer::expired] signal. The virtual timers with the same divider
+ * and phase are always aligned each other, since they refer to the same count of ticks.
+ *
+ * The tick is the period of instance given by [property@InstanceParams:interval], not the
+ * resolution of timer device. When the events for several periods are merged into one event
+ * because they were not read in time, the count of ticks is advanced by the number of periods.
+ *
+ * The events are retrieved from [signal@UserInstance::handle-tick-time-event] and
+ * [signal@UserInstance::handle-real-time-event] signals. When the events are handled by the
+ * function installed by [method@UserInstance.set_tick_time_events_handler] or
+ * [method@UserInstance.set_real_time_events_handler], the call of
+ * [method@Multiplexer.apply_tick_time_events] or [method@Multiplexer.apply_real_time_events]
+ * should be done in the function instead. The virtual timers should be operated in the same
+ * thread as the one to apply events.
+ *
+ * Since: 0.4.
+ */
+struct virtual_timer {
+    guint id;
+    guint divider;
+    guint64 deadline;
+};
+
+typedef struct {
+    ALSATimerUserInstance *instance;
+    gulong handler_ids[2];
+    guint64 tick_count;
+    guint residual_ticks;
+    guint next_timer_id;
+    // The binary min-heap of virtual timers ordered by the next deadline.
+    GArray *timers;
+} ALSATimerMultiplexerPrivate;
+G_DEFINE_TYPE_WITH_PRIVATE(ALSATimerMultiplexer, alsatimer_multiplexer, G_TYPE_OBJECT)
+
+enum timer_multiplexer_prop_type {
+    TIMER_MULTIPLEXER_PROP_TICK_COUNT = 1,
+    TIMER_MULTIPLEXER_PROP_TIMER_COUNT,
+    TIMER_MULTIPLEXER_PROP_COUNT,
+};
+static GParamSpec *timer_multiplexer_props[TIMER_MULTIPLEXER_PROP_COUNT] = { NULL, };
+
+enum timer_multiplexer_sig_type {
+    TIMER_MULTIPLEXER_SIG_EXPIRED = 0,
+    TIMER_MULTIPLEXER_SIG_COUNT,
+};
+static guint timer_multiplexer_sigs[TIMER_MULTIPLEXER_SIG_COUNT] = { 0 };
+
+static void timer_multiplexer_get_property(GObject *obj, guint id, GValue *val, GParamSpec *spec)
+{
+    ALSATimerMultiplexer *self = ALSATIMER_MULTIPLEXER(obj);
+    ALSATimerMultiplexerPrivate *priv = alsatimer_multiplexer_get_instance_private(self);
+
+    switch (id) {
+    case TIMER_MULTIPLEXER_PROP_TICK_COUNT:
+        g_value_set_uint64(val, priv->tick_count);
+        break;
+    case TIMER_MULTIPLEXER_PROP_TIMER_COUNT:
+        g_value_set_uint(val, priv->timers->len);
+        break;
+    default:
+        G_OBJECT_WARN_INVALID_PROPERTY_ID(obj, id, spec);
+        break;
+    }
+}
+
+static void timer_multiplexer_finalize(GObject *obj)
+{
+    ALSATimerMultiplexer *self = ALSATIMER_MULTIPLEXER(obj);
+    ALSATimerMultiplexerPrivate *priv = alsatimer_multiplexer_get_instance_private(self);
+
+    alsatimer_multiplexer_detach(self);
+    g_array_unref(priv->timers);
+
+    G_OBJECT_CLASS(alsatimer_multiplexer_parent_class)->finalize(obj);
+}
+
+static void alsatimer_multiplexer_class_init(ALSATimerMultiplexerClass *klass)
+{
+    GObjectClass *gobject_class = G_OBJECT_CLASS(klass);
+
+    gobject_class->finalize = timer_multiplexer_finalize;
+    gobject_class->get_property = timer_multiplexer_get_property;
+
+    /**
+     * ALSATimerMultiplexer:tick-count:
+     *
+     * The count of ticks accumulated by the applied events.
+     *
+     * Since: 0.4.
+     */
+    timer_multiplexer_props[TIMER_MULTIPLEXER_PROP_TICK_COUNT] =
+        g_param_spec_uint64("tick-count", "tick-count",
+                            "The count of ticks accumulated by the applied events.",
+                            0, G_MAXUINT64,
+                            0,
+                            G_PARAM_READABLE);
+
+    /**
+     * ALSATimerMultiplexer:timer-count:
+     *
+     * The number of virtual timers.
+     *
+     * Since: 0.4.
+     */
+    timer_multiplexer_props[TIMER_MULTIPLEXER_PROP_TIMER_COUNT] =
+        g_param_spec_uint("timer-count", "timer-count",
+                          "The number of virtual timers.",
+                          0, G_MAXUINT,
+                          0,
+                          G_PARAM_READABLE);
+
+    g_object_class_install_properties(gobject_class, TIMER_MULTIPLEXER_PROP_COUNT,
+                                      timer_multiplexer_props);
+
+    /**
+     * ALSATimerMultiplexer::expired:
+     * @self: A [class@Multiplexer].
+     * @timer_id: The numeric identifier of virtual timer.
+     * @expirations: The number of expirations since the last emission for the virtual timer. It
+     *               is larger than 1 when the applied event includes ticks over the divider.
+     *
+     * Emitted when the virtual timer expires.
+     *
+     * Since: 0.4.
+     */
+    timer_multiplexer_sigs[TIMER_MULTIPLEXER_SIG_EXPIRED] =
+        g_signal_new("expired",
+                     G_OBJECT_CLASS_TYPE(klass),
+                     G_SIGNAL_RUN_LAST,
+                     G_STRUCT_OFFSET(ALSATimerMultiplexerClass, expired),
+                     NULL, NULL,
+                     NULL,
+                     G_TYPE_NONE, 2, G_TYPE_UINT, G_TYPE_UINT64);
+}
+
+static void alsatimer_multiplexer_init(ALSATimerMultiplexer *self)
+{
+    ALSATimerMultiplexerPrivate *priv = alsatimer_multiplexer_get_instance_private(self);
+
+    priv->timers = g_array_new(FALSE, FALSE, sizeof(struct virtual_timer));
+}
+
+/**
+ * alsatimer_multiplexer_new:
+ *
+ * Allocate and return an instance of [class@Multiplexer].
+ *
+ * Returns: An instance of [class@Multiplexer].
+ *
+ * Since: 0.4.
+ */
+ALSATimerMultiplexer *alsatimer_multiplexer_new()
+{
+    return g_object_new(ALSATIMER_TYPE_MULTIPLEXER, NULL);
+}
+
+static void handle_tick_time_event(ALSATimerUserInstance *instance,
+                                   const ALSATimerTickTimeEvent *event, gpointer user_data)
+{
+    alsatimer_multiplexer_apply_tick_time_events(ALSATIMER_MULTIPLEXER(user_data), event, 1);
+}
+
+static void handle_real_time_event(ALSATimerUserInstance *instance,
+                                   const ALSATimerRealTimeEvent *event, gpointer user_data)
+{
+    alsatimer_multiplexer_apply_real_time_events(ALSATIMER_MULTIPLEXER(user_data), event, 1);
+}
+
+/**
+ * alsatimer_multiplexer_attach:
+ * @self: A [class@Multiplexer].
+ * @instance: A [class@UserInstance] opened in advance.
+ * @device_id: A [struct@DeviceId] to which the instance is attached.
+ * @error: A [struct@GLib.Error]. Error is generated with domain of `ALSATimer.UserInstanceError`.
+ *
+ * Attach the instance to the timer device by the call of [method@UserInstance.attach], then
+ * accumulate the count of ticks by the events of instance. The count of ticks is kept over
+ * detachment so that the phase of virtual timers is preserved.
+ *
+ * Returns: %TRUE when the overall operation finishes successfully, else %FALSE.
+ *
+ * Since: 0.4.
+ */
+gboolean alsatimer_multiplexer_attach(ALSATimerMultiplexer *self, ALSATimerUserInstance *instance,
+                                      ALSATimerDeviceId *device_id, GError **error)
+{
+    ALSATimerMultiplexerPrivate *priv;
+
+    g_return_val_if_fail(ALSATIMER_IS_MULTIPLEXER(self), FALSE);
+    priv = alsatimer_multiplexer_get_instance_private(self);
+    g_return_val_if_fail(priv->instance == NULL, FALSE);
+
+    g_return_val_if_fail(ALSATIMER_IS_USER_INSTANCE(instance), FALSE);
+    g_return_val_if_fail(device_id != NULL, FALSE);
+    g_return_val_if_fail(error == NULL || *error == NULL, FALSE);
+
+    if (!alsatimer_user_instance_attach(instance, device_id, error))
+        return FALSE;
+
+    priv->instance = g_object_ref(instance);
+    priv->residual_ticks = 0;
+    priv->handler_ids[0] = g_signal_connect(instance, "handle-tick-time-event",
+                                            G_CALLBACK(handle_tick_time_event), self);
+    priv->handler_ids[1] = g_signal_connect(instance, "handle-real-time-event",
+                                            G_CALLBACK(handle_real_time_event), self);
+
+    return TRUE;
+}
+
+/**
+ * alsatimer_multiplexer_detach:
+ * @self: A [class@Multiplexer].
+ *
+ * Stop to accumulate the count of ticks by the events of instance, then release the instance.
+ *
+ * Since: 0.4.
+ */
+void alsatimer_multiplexer_detach(ALSATimerMultiplexer *self)
+{
+    ALSATimerMultiplexerPrivate *priv;
+    int i;
+
+    g_return_if_fail(ALSATIMER_IS_MULTIPLEXER(self));
+    priv = alsatimer_multiplexer_get_instance_private(self);
+
+    if (priv->instance == NULL)
+        return;
+
+    for (i = 0; i < G_N_ELEMENTS(priv->handler_ids); ++i)
+        g_signal_handler_disconnect(priv->instance, priv->handler_ids[i]);
+    g_object_unref(priv->instance);
+    priv->instance = NULL;
+}
+
+static gboolean timer_precedes(const struct virtual_timer *lhs, const struct virtual_timer *rhs)
+{
+    // The virtual timer added earlier precedes at the same deadline.
+    if (lhs->deadline != rhs->deadline)
+        return lhs->deadline < rhs->deadline;
+    return lhs->id < rhs->id;
+}
+
+static void swap_timers(GArray *timers, guint lhs, guint rhs)
+{
+    struct virtual_timer tmp = g_array_index(timers, struct virtual_timer, lhs);
+
+    g_array_index(timers, struct virtual_timer, lhs) =
+                                            g_array_index(timers, struct virtual_timer, rhs);
+    g_array_index(timers, struct virtual_timer, rhs) = tmp;
+}
+
+static void sift_up(GArray *timers, guint index)
+{
+    while (index > 0) {
+        guint parent = (index - 1) / 2;
+
+        if (!timer_precedes(&g_array_index(timers, struct virtual_timer, index),
+                            &g_array_index(timers, struct virtual_timer, parent)))
+            break;
+        swap_timers(timers, index, parent);
+        index = parent;
+    }
+}
+
+static void sift_down(GArray *timers, guint index)
+{
+    while (TRUE) {
+        guint left = index * 2 + 1;
+        guint right = left + 1;
+        guint smallest = index;
+
+        if (left < timers->len &&
+            timer_precedes(&g_array_index(timers, struct virtual_timer, left),
+                           &g_array_index(timers, struct virtual_timer, smallest)))
+            smallest = left;
+        if (right < timers->len &&
+            timer_precedes(&g_array_index(timers, struct virtual_timer, right),
+                           &g_array_index(timers, struct virtual_timer, smallest)))
+            smallest = right;
+
+        if (smallest == index)
+            break;
+        swap_timers(timers, index, smallest);
+        index = smallest;
+    }
+}
+
+/**
+ * alsatimer_multiplexer_add_timer:
+ * @self: A [class@Multiplexer].
+ * @divider: The number of ticks for the period of virtual timer. It should be larger than zero.
+ * @phase: The offset in ticks for the period of virtual timer. It should be less than the divider.
+ * @timer_id: (out): The numeric identifier of added virtual timer.
+ *
+ * Add virtual timer which expires at the count of ticks satisfying the divider and the phase. The
+ * first expiration occurs after the current count of ticks.
+ *
+ * Since: 0.4.
+ */
+void alsatimer_multiplexer_add_timer(ALSATimerMultiplexer *self, guint divider, guint phase,
+                                     guint *timer_id)
+{
+    ALSATimerMultiplexerPrivate *priv;
+    struct virtual_timer timer;
+
+    g_return_if_fail(ALSATIMER_IS_MULTIPLEXER(self));
+    priv = alsatimer_multiplexer_get_instance_private(self);
+
+    g_return_if_fail(divider > 0);
+    g_return_if_fail(phase < divider);
+    g_return_if_fail(timer_id != NULL);
+
+    timer.id = priv->next_timer_id++;
+    timer.divider = divider;
+    timer.deadline = priv->tick_count - priv->tick_count % divider + phase;
+    if (timer.deadline <= priv->tick_count)
+        timer.deadline += divider;
+
+    g_array_append_val(priv->timers, timer);
+    sift_up(priv->timers, priv->timers->len - 1);
+
+    *timer_id = timer.id;
+}
+
+/**
+ * alsatimer_multiplexer_remove_timer:
+ * @self: A [class@Multiplexer].
+ * @timer_id: The numeric identifier of virtual timer.
+ *
+ * Remove the virtual timer.
+ *
+ * Returns: %TRUE when the virtual timer is found and removed, else %FALSE.
+ *
+ * Since: 0.4.
+ */
+gboolean alsatimer_multiplexer_remove_timer(ALSATimerMultiplexer *self, guint timer_id)
+{
+    ALSATimerMultiplexerPrivate *priv;
+    guint last;
+    guint i;
+
+    g_return_val_if_fail(ALSATIMER_IS_MULTIPLEXER(self), FALSE);
+    priv = alsatimer_multiplexer_get_instance_private(self);
+
+    for (i = 0; i < priv->timers->len; ++i) {
+        if (g_array_index(priv->timers, struct virtual_timer, i).id == timer_id)
+            break;
+    }
+    if (i == priv->timers->len)
+        return FALSE;
+
+    last = priv->timers->len - 1;
+    if (i != last)
+        swap_timers(priv->timers, i, last);
+    g_array_set_size(priv->timers, last);
+
+    if (i < last) {
+        sift_down(priv->timers, i);
+        sift_up(priv->timers, i);
+    }
+
+    return TRUE;
+}
+
+static void advance_ticks(ALSATimerMultiplexer *self, ALSATimerMultiplexerPrivate *priv,
+                          guint ticks)
+{
+    guint interval = 0;
+    guint64 periods;
+
+    if (priv->instance != NULL)
+        interval = timer_user_instance_get_interval_ticks(priv->instance);
+
+    // NOTE: The event carries the number of ticks in the resolution of timer device. Convert it to
+    // the number of periods of instance, and keep the remainder for the next event. Each event is
+    // counted as one period when the interval is unknown.
+    if (interval > 0) {
+        guint64 total = (guint64)priv->residual_ticks + ticks;
+
+        periods = total / interval;
+        priv->residual_ticks = (guint)(total % interval);
+    } else {
+        periods = 1;
+    }
+
+    if (periods == 0)
+        return;
+    priv->tick_count += periods;
+
+    // NOTE: The virtual timer at the top of heap is re-scheduled before the signal emission so
+    // that any virtual timer can be added or removed in the handler of signal.
+    while (priv->timers->len > 0) {
+        struct virtual_timer *timer = &g_array_index(priv->timers, struct virtual_timer, 0);
+        guint64 expirations;
+        guint timer_id;
+
+        if (timer->deadline > priv->tick_count)
+            break;
+
+        expirations = (priv->tick_count - timer->deadline) / timer->divider + 1;
+        timer->deadline += expirations * timer->divider;
+        timer_id = timer->id;
+        sift_down(priv->timers, 0);
+
+        g_signal_emit(self, timer_multiplexer_sigs[TIMER_MULTIPLEXER_SIG_EXPIRED], 0, timer_id,
+                      expirations);
+    }
+}
+
+/**
+ * alsatimer_multiplexer_apply_tick_time_events:
+ * @self: A [class@Multiplexer].
+ * @events: (array length=event_count): The array of [struct@TickTimeEvent].
+ * @event_count: The number of events in the array.
+ *
+ * Accumulate the count of ticks by the events, then emit [signal@Multiplexer::expired] signal for
+ * the expired virtual timers. The call of function is done internally for
+ * [signal@UserInstance::handle-tick-time-event] signal.
+ *
+ * Since: 0.4.
+ */
+void alsatimer_multiplexer_apply_tick_time_events(ALSATimerMultiplexer *self,
+                                                  const ALSATimerTickTimeEvent *events,
+                                                  gsize event_count)
+{
+    ALSATimerMultiplexerPrivate *priv;
+    gsize i;
+
+    g_return_if_fail(ALSATIMER_IS_MULTIPLEXER(self));
+    priv = alsatimer_multiplexer_get_instance_private(self);
+
+    g_return_if_fail(events != NULL || event_count == 0);
+
+    for (i = 0; i < event_count; ++i)
+        advance_ticks(self, priv, events[i].ticks);
+}
+
+/**
+ * alsatimer_multiplexer_apply_real_time_events:
+ * @self: A [class@Multiplexer].
+ * @events: (array length=event_count): The array of [struct@RealTimeEvent].
+ * @event_count: The number of events in the array.
+ *
+ * Accumulate the count of ticks by the events of [enum@RealTimeEventType].TICK, then emit
+ * [signal@Multiplexer::expired] signal for the expired virtual timers. The other events are
+ * ignored. The call of function is done internally for
+ * [signal@UserInstance::handle-real-time-event] signal.
+ *
+ * Since: 0.4.
+ */
+void alsatimer_multiplexer_apply_real_time_events(ALSATimerMultiplexer *self,
+                                                  const ALSATimerRealTimeEvent *events,
+                                                  gsize event_count)
+{
+    ALSATimerMultiplexerPrivate *priv;
+    gsize i;
+
+    g_return_if_fail(ALSATIMER_IS_MULTIPLEXER(self));
+    priv = alsatimer_multiplexer_get_instance_private(self);
+
+    g_return_if_fail(events != NULL || event_count == 0);
+
+    for (i = 0; i < event_count; ++i) {
+        if (events[i].event == SNDRV_TIMER_EVENT_TICK)
+            advance_ticks(self, priv, events[i].val);
+    }
+}
@@ -0,0 +1,49 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+#ifndef __ALSA_GOBJECT_ALSATIMER_MULTIPLEXER_H__
+#define __ALSA_GOBJECT_ALSATIMER_MULTIPLEXER_H__
+
+#include <alsatimer.h>
+
+G_BEGIN_DECLS
+
+#define ALSATIMER_TYPE_MULTIPLEXER  (alsatimer_multiplexer_get_type())
+
+G_DECLARE_DERIVABLE_TYPE(ALSATimerMultiplexer, alsatimer_multiplexer, ALSATIMER, MULTIPLEXER,
+                         GObject);
+
+struct _ALSATimerMultiplexerClass {
+    GObjectClass parent_class;
+
+    /**
+     * ALSATimerMultiplexerClass::expired:
+     * @self: A [class@Multiplexer].
+     * @timer_id: The numeric identifier of virtual timer.
+     * @expirations: The number of expirations since the last emission for the virtual timer.
+     *
+     * Class closure for the [signal@Multiplexer::expired] signal.
+     *
+     * Since: 0.4.
+     */
+    void (*expired)(ALSATimerMultiplexer *self, guint timer_id, guint64 expirations);
+};
+
+ALSATimerMultiplexer *alsatimer_multiplexer_new();
+
+gboolean alsatimer_multiplexer_attach(ALSATimerMultiplexer *self, ALSATimerUserInstance *instance,
+                                      ALSATimerDeviceId *device_id, GError **error);
+void alsatimer_multiplexer_detach(ALSATimerMultiplexer *self);
+
+void alsatimer_multiplexer_add_timer(ALSATimerMultiplexer *self, guint divider, guint phase,
+                                     guint *timer_id);
+gboolean alsatimer_multiplexer_remove_timer(ALSATimerMultiplexer *self, guint timer_id);
+
+void alsatimer_multiplexer_apply_tick_time_events(ALSATimerMultiplexer *self,
+                                                  const ALSATimerTickTimeEvent *events,
+                                                  gsize event_count);
+void alsatimer_multiplexer_apply_real_time_events(ALSATimerMultiplexer *self,
+                                                  const ALSATimerRealTimeEvent *events,
+                                                  gsize event_count);
+
+G_END_DECLS
+
+#endif
@@ -24,6 +24,24 @@ void timer_instance_params_refer_private(ALSATimerInstanceParams *self,
 void timer_instance_status_refer_private(ALSATimerInstanceStatus *self,
                                          struct snd_timer_status **status);
 
+#define TIMER_EVENT_STATISTICS_BIN_COUNT    32
+
+struct timer_event_statistics {
+    guint event_count;
+    guint tick_count;
+    guint64 expected_interval;
+    guint interval_deviation_bins[TIMER_EVENT_STATISTICS_BIN_COUNT];
+    guint wakeup_delay_bins[TIMER_EVENT_STATISTICS_BIN_COUNT];
+};
+
+void timer_event_statistics_refer_private(ALSATimerEventStatistics *self,
+                                          struct timer_event_statistics **stats,
+                                          guint **overrun, guint **lost);
+
+guint timer_event_statistics_bin_index(guint64 val);
+
+guint timer_user_instance_get_interval_ticks(ALSATimerUserInstance *self);
+
 G_END_DECLS
 
 #endif
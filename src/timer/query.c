@@ -11,6 +11,7 @@
 #include <stdio.h>
 #include <stdbool.h>
 #include <errno.h>
+#include <poll.h>
 
 #include <time.h>
 
@@ -106,6 +107,7 @@ gboolean alsatimer_get_device_id_list(GList **entries, GError **error)
     struct snd_timer_id id = {
         .dev_class = -1,
     };
+    GList *head = NULL;
     int fd;
     gboolean result;
 
@@ -128,11 +130,77 @@ gboolean alsatimer_get_device_id_list(GList **entries, GError **error)
             break;
 
         entry = g_boxed_copy(ALSATIMER_TYPE_DEVICE_ID, &id);
-        *entries = g_list_append(*entries, entry);
+        head = g_list_prepend(head, entry);
     }
 
     close(fd);
 
+    // NOTE: Prepend entries and reverse them at last to avoid traversing the list for each entry.
+    if (result)
+        *entries = g_list_concat(*entries, g_list_reverse(head));
+    else
+        g_list_free_full(head, g_free);
+
+    return result;
+}
+
+/**
+ * alsatimer_get_device_id_array:
+ * @entries: (array length=entry_count)(out): The array with entries of [struct@DeviceId].
+ * @entry_count: The number of entries.
+ * @error: A [struct@GLib.Error]. Error is generated with domain of `GLib.FileError`.
+ *
+ * Get the array of existent timer device. Unlike [func@get_device_id_list], the entries are stored
+ * in a single contiguous buffer.
+ *
+ * The call of function executes `open(2)`, `close(2)`, and `ioctl(2)` system call with
+ * `SNDRV_TIMER_IOCTL_NEXT_DEVICE` command for ALSA timer character device.
+ *
+ * Returns: %TRUE when the overall operation finishes successfully, else %FALSE.
+ *
+ * Since: 0.4.
+ */
+gboolean alsatimer_get_device_id_array(ALSATimerDeviceId **entries, gsize *entry_count,
+                                       GError **error)
+{
+    struct snd_timer_id id = {
+        .dev_class = -1,
+    };
+    GArray *array;
+    int fd;
+    gboolean result;
+
+    g_return_val_if_fail(entries != NULL, FALSE);
+    g_return_val_if_fail(entry_count != NULL, FALSE);
+    g_return_val_if_fail(error == NULL || *error == NULL, FALSE);
+
+    if (!open_fd(&fd, error))
+        return FALSE;
+
+    array = g_array_new(FALSE, FALSE, sizeof(id));
+
+    result = TRUE;
+    while (true) {
+        if (ioctl(fd, SNDRV_TIMER_IOCTL_NEXT_DEVICE, &id) < 0) {
+            generate_file_error(error, errno, "ioctl(SNDRV_TIMER_IOCTL_NEXT_DEVICE)");
+            result = FALSE;
+            break;
+        }
+        if (id.dev_class == SNDRV_TIMER_CLASS_NONE)
+            break;
+
+        g_array_append_val(array, id);
+    }
+
+    close(fd);
+
+    if (result) {
+        *entry_count = array->len;
+        *entries = (ALSATimerDeviceId *)g_array_free(array, FALSE);
+    } else {
+        g_array_free(array, TRUE);
+    }
+
     return result;
 }
 
@@ -363,3 +431,266 @@ gboolean alsatimer_get_real_time_clock_id(int *clock_id, GError **error)
 
     return TRUE;
 }
+
+// The interval of timer for the probe of jitter.
+#define PROBE_INTERVAL_NSEC     1000000
+// The minimum timeout in millisecond to wait for event in the probe of jitter.
+#define PROBE_TIMEOUT_MSEC      10
+
+struct device_rank {
+    struct snd_timer_id id;
+    gboolean slave;
+    gboolean global;
+    guint64 resolution;
+    guint64 jitter;
+};
+
+static gint64 get_monotonic_nsec(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (gint64)ts.tv_sec * G_GINT64_CONSTANT(1000000000) + ts.tv_nsec;
+}
+
+// Return the mean absolute deviation of intervals between events received in user space against
+// the intervals expected by the ticks of events, or G_MAXUINT64 when the probe is not available.
+static guint64 probe_device_jitter(int fd, const struct device_rank *rank, guint probe_count)
+{
+    struct snd_timer_select sel = {0};
+    struct snd_timer_params params = {0};
+    guint64 total = 0;
+    gint64 prev = -1;
+    int timeout;
+    guint count = 0;
+
+    sel.id = rank->id;
+    if (ioctl(fd, SNDRV_TIMER_IOCTL_SELECT, &sel) < 0)
+        return G_MAXUINT64;
+
+    params.flags = SNDRV_TIMER_PSFLG_AUTO;
+    params.ticks = MAX(1, PROBE_INTERVAL_NSEC / rank->resolution);
+    if (ioctl(fd, SNDRV_TIMER_IOCTL_PARAMS, &params) < 0)
+        return G_MAXUINT64;
+
+    timeout = MAX(PROBE_TIMEOUT_MSEC, params.ticks * rank->resolution * 4 / 1000000);
+
+    if (ioctl(fd, SNDRV_TIMER_IOCTL_START) < 0)
+        return G_MAXUINT64;
+
+    // NOTE: The first event is just used as the origin of intervals.
+    while (count < probe_count) {
+        struct pollfd pfd = { .fd = fd, .events = POLLIN, };
+        struct snd_timer_read ev;
+        gint64 now;
+
+        if (poll(&pfd, 1, timeout) <= 0 || !(pfd.revents & POLLIN))
+            break;
+        if (read(fd, &ev, sizeof(ev)) != sizeof(ev))
+            break;
+        now = get_monotonic_nsec();
+
+        if (prev >= 0) {
+            guint64 interval = (guint64)(now - prev);
+            guint64 expected = (guint64)ev.ticks * ev.resolution;
+
+            total += interval > expected ? interval - expected : expected - interval;
+            ++count;
+        }
+        prev = now;
+    }
+
+    ioctl(fd, SNDRV_TIMER_IOCTL_STOP);
+
+    if (count < probe_count)
+        return G_MAXUINT64;
+
+    return total / count;
+}
+
+static gint compare_device_rank(gconstpointer a, gconstpointer b)
+{
+    const struct device_rank *lhs = a;
+    const struct device_rank *rhs = b;
+
+    // The timer device which can not be controlled is the last resort.
+    if (lhs->slave != rhs->slave)
+        return lhs->slave ? 1 : -1;
+
+    // The zero means that the resolution is unknown.
+    if (lhs->resolution != rhs->resolution) {
+        if (lhs->resolution == 0 || rhs->resolution == 0)
+            return lhs->resolution == 0 ? 1 : -1;
+        return lhs->resolution < rhs->resolution ? -1 : 1;
+    }
+
+    if (lhs->jitter != rhs->jitter)
+        return lhs->jitter < rhs->jitter ? -1 : 1;
+
+    // The global timer device is independent of any sound card.
+    if (lhs->global != rhs->global)
+        return lhs->global ? -1 : 1;
+
+    return 0;
+}
+
+static gboolean rank_devices(guint probe_count, GArray *ranks, GError **error)
+{
+    struct snd_timer_id id = {
+        .dev_class = -1,
+    };
+    int fd;
+    gboolean result;
+    guint i;
+
+    if (!open_fd(&fd, error))
+        return FALSE;
+
+    result = TRUE;
+    while (true) {
+        struct snd_timer_ginfo info = {0};
+        struct device_rank rank = {0};
+
+        if (ioctl(fd, SNDRV_TIMER_IOCTL_NEXT_DEVICE, &id) < 0) {
+            generate_file_error(error, errno, "ioctl(SNDRV_TIMER_IOCTL_NEXT_DEVICE)");
+            result = FALSE;
+            break;
+        }
+        if (id.dev_class == SNDRV_TIMER_CLASS_NONE)
+            break;
+
+        info.tid = id;
+        if (ioctl(fd, SNDRV_TIMER_IOCTL_GINFO, &info) < 0) {
+            // The timer device can be removed in the middle of iteration.
+            if (errno == ENODEV)
+                continue;
+            generate_file_error(error, errno, "ioctl(SNDRV_TIMER_IOCTL_GINFO)");
+            result = FALSE;
+            break;
+        }
+
+        rank.id = id;
+        rank.slave = id.dev_class == SNDRV_TIMER_CLASS_SLAVE ||
+                     (info.flags & SNDRV_TIMER_FLG_SLAVE);
+        rank.global = id.dev_class == SNDRV_TIMER_CLASS_GLOBAL;
+        rank.resolution = info.resolution;
+        rank.jitter = G_MAXUINT64;
+        g_array_append_val(ranks, rank);
+    }
+
+    // NOTE: The instance of the file descriptor is attached to each timer device in turn, since the
+    // attachment to the other timer device releases the previous one.
+    if (result && probe_count > 0) {
+        for (i = 0; i < ranks->len; ++i) {
+            struct device_rank *rank = &g_array_index(ranks, struct device_rank, i);
+
+            if (!rank->slave && rank->resolution > 0)
+                rank->jitter = probe_device_jitter(fd, rank, probe_count);
+        }
+    }
+
+    close(fd);
+
+    if (result)
+        g_array_sort(ranks, compare_device_rank);
+
+    return result;
+}
+
+/**
+ * alsatimer_get_ranked_device_id_array:
+ * @probe_count: The number of intervals measured to probe jitter of each timer device. When zero,
+ *               the probe is skipped.
+ * @entries: (array length=entry_count)(out): The array with entries of [struct@DeviceId], ranked
+ *           from the best.
+ * @entry_count: The number of entries.
+ * @error: A [struct@GLib.Error]. Error is generated with domain of `GLib.FileError`.
+ *
+ * Get the array of existent timer device, ranked by the preference to attach. The timer device
+ * which can not be controlled, like slave, is ranked last. The rest is ranked by the resolution,
+ * then by the jitter measured in the probe, then by whether to be global or not.
+ *
+ * In the probe, the timer device is started with the interval close to 1 millisecond, then the
+ * intervals of events received in user space are compared to the expected intervals. The timer
+ * device which does not deliver events in the probe, like the timer for PCM substream not running,
+ * is ranked after the ones measured successfully with the same resolution.
+ *
+ * The call of function executes `open(2)`, `close(2)`, and `ioctl(2)` system call with
+ * `SNDRV_TIMER_IOCTL_NEXT_DEVICE` and `SNDRV_TIMER_IOCTL_GINFO` commands for ALSA timer character
+ * device. For the probe, it executes `ioctl(2)` system call with `SNDRV_TIMER_IOCTL_SELECT`,
+ * `SNDRV_TIMER_IOCTL_PARAMS`, `SNDRV_TIMER_IOCTL_START`, and `SNDRV_TIMER_IOCTL_STOP` commands,
+ * `poll(2)`, and `read(2)` system calls. All of them are done with the same file descriptor.
+ *
+ * Returns: %TRUE when the overall operation finishes successfully, else %FALSE.
+ *
+ * Since: 0.4.
+ */
+gboolean alsatimer_get_ranked_device_id_array(guint probe_count, ALSATimerDeviceId **entries,
+                                              gsize *entry_count, GError **error)
+{
+    GArray *ranks;
+    guint i;
+
+    g_return_val_if_fail(entries != NULL, FALSE);
+    g_return_val_if_fail(entry_count != NULL, FALSE);
+    g_return_val_if_fail(error == NULL || *error == NULL, FALSE);
+
+    ranks = g_array_new(FALSE, FALSE, sizeof(struct device_rank));
+
+    if (!rank_devices(probe_count, ranks, error)) {
+        g_array_free(ranks, TRUE);
+        return FALSE;
+    }
+
+    *entry_count = ranks->len;
+    *entries = g_new(ALSATimerDeviceId, ranks->len);
+    for (i = 0; i < ranks->len; ++i)
+        (*entries)[i] = g_array_index(ranks, struct device_rank, i).id;
+
+    g_array_free(ranks, TRUE);
+
+    return TRUE;
+}
+
+/**
+ * alsatimer_select_best_device:
+ * @probe_count: The number of intervals measured to probe jitter of each timer device. When zero,
+ *               the probe is skipped.
+ * @device_id: (out): The [struct@DeviceId] ranked as the best.
+ * @error: A [struct@GLib.Error]. Error is generated with domain of `GLib.FileError`.
+ *
+ * Select the timer device to attach. The rank is decided as well as
+ * [func@get_ranked_device_id_array].
+ *
+ * The call of function executes the same system calls as [func@get_ranked_device_id_array].
+ *
+ * Returns: %TRUE when the overall operation finishes successfully, else %FALSE.
+ *
+ * Since: 0.4.
+ */
+gboolean alsatimer_select_best_device(guint probe_count, ALSATimerDeviceId **device_id,
+                                      GError **error)
+{
+    GArray *ranks;
+    gboolean result;
+
+    g_return_val_if_fail(device_id != NULL, FALSE);
+    g_return_val_if_fail(error == NULL || *error == NULL, FALSE);
+
+    ranks = g_array_new(FALSE, FALSE, sizeof(struct device_rank));
+
+    result = rank_devices(probe_count, ranks, error);
+    if (result) {
+        if (ranks->len > 0) {
+            *device_id = g_boxed_copy(ALSATIMER_TYPE_DEVICE_ID,
+                                      &g_array_index(ranks, struct device_rank, 0).id);
+        } else {
+            generate_file_error(error, ENODEV, "No timer device is available");
+            result = FALSE;
+        }
+    }
+
+    g_array_free(ranks, TRUE);
+
+    return result;
+}
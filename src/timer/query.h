@@ -11,6 +11,8 @@ gboolean alsatimer_get_sysname(char **sysname, GError **error);
 gboolean alsatimer_get_devnode(char **devnode, GError **error);
 
 gboolean alsatimer_get_device_id_list(GList **entries, GError **error);
+gboolean alsatimer_get_device_id_array(ALSATimerDeviceId **entries, gsize *entry_count,
+                                       GError **error);
 
 gboolean alsatimer_get_device_info(ALSATimerDeviceId *device_id, ALSATimerDeviceInfo **device_info,
                                    GError **error);
@@ -23,6 +25,11 @@ gboolean alsatimer_set_device_params(ALSATimerDeviceId *device_id,
 
 gboolean alsatimer_get_real_time_clock_id(int *clock_id, GError **error);
 
+gboolean alsatimer_get_ranked_device_id_array(guint probe_count, ALSATimerDeviceId **entries,
+                                              gsize *entry_count, GError **error);
+gboolean alsatimer_select_best_device(guint probe_count, ALSATimerDeviceId **device_id,
+                                      GError **error);
+
 G_END_DECLS
 
 #endif
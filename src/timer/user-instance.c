@@ -1,4 +1,6 @@
 // SPDX-License-Identifier: LGPL-3.0-or-later
+// For CPU_SET() and sched_setaffinity().
+#define _GNU_SOURCE
 #include "privates.h"
 
 #include <utils.h>
@@ -8,7 +10,12 @@
 #include <fcntl.h>
 #include <unistd.h>
 #include <sys/ioctl.h>
+#include <poll.h>
+#include <sys/eventfd.h>
 #include <errno.h>
+#include <time.h>
+#include <pthread.h>
+#include <sched.h>
 
 /**
  * ALSATimerUserInstance:
@@ -19,11 +26,68 @@
  * [method@UserInstance.open], the object maintains file descriptor till object destruction. After
  * calling [method@UserInstance.attach] or [method@UserInstance.attach_as_slave], the user instance
  * is attached to any timer device or the other instance as slave.
+ *
+ * As an alternative of the source returned by [method@UserInstance.create_source], the call of
+ * [method@UserInstance.start_worker] starts a thread to read events and call the function
+ * installed by [method@UserInstance.set_tick_time_events_handler] or
+ * [method@UserInstance.set_real_time_events_handler] in the thread, thus the latency to handle
+ * the events does not depend on the other sources in [struct@GLib.MainContext].
  */
+struct timer_worker {
+    GThread *thread;
+    ALSATimerUserInstance *self;
+    GMainContext *context;
+    int fd;
+    int stop_fd;
+    ALSATimerEventType event_type;
+    guint8 *buf;
+    gsize buf_len;
+    gint priority;
+    guint *cpus;
+    gsize cpu_count;
+
+    GMutex mutex;
+    GCond cond;
+    gboolean started;
+    int sched_err;
+    const char *sched_call;
+    gint disconnected;
+};
+
+// NOTE: The statistics are written by the worker thread only, and read by any thread. The sequence
+// number is odd during writing so that reader can detect torn read and retry, thus the worker
+// thread never blocks for the reader.
+struct timer_latency_stats {
+    gint seq;
+    guint64 count;
+    guint64 min;
+    guint64 max;
+    guint64 total;
+};
+
 typedef struct {
     int fd;
     ALSATimerEventType event_type;
     guint16 proto_ver_triplet[3];
+
+    ALSATimerUserInstanceTickTimeEventsHandler tick_time_events_handler;
+    gpointer tick_time_events_handler_data;
+    GDestroyNotify tick_time_events_handler_destroy;
+
+    ALSATimerUserInstanceRealTimeEventsHandler real_time_events_handler;
+    gpointer real_time_events_handler_data;
+    GDestroyNotify real_time_events_handler_destroy;
+
+    struct timer_worker *worker;
+    struct timer_latency_stats latency_stats;
+
+    int tstamp_clock_id;
+    gboolean collect_event_statistics;
+    guint interval_ticks;
+    guint tick_resolution;
+    gint64 prev_tick_tstamp;
+    gint prev_tick_tstamp_expired;
+    struct timer_event_statistics event_statistics;
 } ALSATimerUserInstancePrivate;
 G_DEFINE_TYPE_WITH_PRIVATE(ALSATimerUserInstance, alsatimer_user_instance, G_TYPE_OBJECT)
 
@@ -58,6 +122,16 @@ typedef struct {
     unsigned int buf_len;
 } TimerUserInstanceSource;
 
+enum timer_user_instance_prop_type {
+    TIMER_USER_INSTANCE_PROP_COLLECT_EVENT_STATISTICS = 1,
+    TIMER_USER_INSTANCE_PROP_WORKER_EVENT_COUNT,
+    TIMER_USER_INSTANCE_PROP_WORKER_MIN_LATENCY,
+    TIMER_USER_INSTANCE_PROP_WORKER_MAX_LATENCY,
+    TIMER_USER_INSTANCE_PROP_WORKER_MEAN_LATENCY,
+    TIMER_USER_INSTANCE_PROP_COUNT,
+};
+static GParamSpec *timer_user_instance_props[TIMER_USER_INSTANCE_PROP_COUNT] = { NULL, };
+
 enum timer_user_instance_sig_type {
     TIMER_USER_INSTANCE_SIG_HANDLE_TICK_TIME_EVENT = 0,
     TIMER_USER_INSTANCE_SIG_HANDLE_REAL_TIME_EVENT,
@@ -66,12 +140,85 @@ enum timer_user_instance_sig_type {
 };
 static guint timer_user_instance_sigs[TIMER_USER_INSTANCE_SIG_COUNT] = { 0 };
 
+static void timer_user_instance_set_property(GObject *obj, guint id, const GValue *val,
+                                             GParamSpec *spec)
+{
+    ALSATimerUserInstance *self = ALSATIMER_USER_INSTANCE(obj);
+    ALSATimerUserInstancePrivate *priv =
+                            alsatimer_user_instance_get_instance_private(self);
+
+    switch (id) {
+    case TIMER_USER_INSTANCE_PROP_COLLECT_EVENT_STATISTICS:
+        g_atomic_int_set(&priv->collect_event_statistics, g_value_get_boolean(val));
+        break;
+    default:
+        G_OBJECT_WARN_INVALID_PROPERTY_ID(obj, id, spec);
+        break;
+    }
+}
+
+static void read_latency_stats(ALSATimerUserInstancePrivate *priv,
+                               struct timer_latency_stats *stats)
+{
+    const struct timer_latency_stats *src = &priv->latency_stats;
+    gint seq;
+
+    do {
+        seq = g_atomic_int_get(&src->seq);
+        if (seq & 1) {
+            g_thread_yield();
+            continue;
+        }
+
+        stats->count = src->count;
+        stats->min = src->min;
+        stats->max = src->max;
+        stats->total = src->total;
+    } while ((seq & 1) || g_atomic_int_get(&src->seq) != seq);
+}
+
+static void timer_user_instance_get_property(GObject *obj, guint id, GValue *val,
+                                             GParamSpec *spec)
+{
+    ALSATimerUserInstance *self = ALSATIMER_USER_INSTANCE(obj);
+    ALSATimerUserInstancePrivate *priv =
+                            alsatimer_user_instance_get_instance_private(self);
+    struct timer_latency_stats stats;
+
+    read_latency_stats(priv, &stats);
+
+    switch (id) {
+    case TIMER_USER_INSTANCE_PROP_COLLECT_EVENT_STATISTICS:
+        g_value_set_boolean(val, g_atomic_int_get(&priv->collect_event_statistics));
+        break;
+    case TIMER_USER_INSTANCE_PROP_WORKER_EVENT_COUNT:
+        g_value_set_uint64(val, stats.count);
+        break;
+    case TIMER_USER_INSTANCE_PROP_WORKER_MIN_LATENCY:
+        g_value_set_uint64(val, stats.min);
+        break;
+    case TIMER_USER_INSTANCE_PROP_WORKER_MAX_LATENCY:
+        g_value_set_uint64(val, stats.max);
+        break;
+    case TIMER_USER_INSTANCE_PROP_WORKER_MEAN_LATENCY:
+        g_value_set_uint64(val, stats.count > 0 ? stats.total / stats.count : 0);
+        break;
+    default:
+        G_OBJECT_WARN_INVALID_PROPERTY_ID(obj, id, spec);
+        break;
+    }
+}
+
 static void timer_user_instance_finalize(GObject *obj)
 {
     ALSATimerUserInstance *self = ALSATIMER_USER_INSTANCE(obj);
     ALSATimerUserInstancePrivate *priv =
                             alsatimer_user_instance_get_instance_private(self);
 
+    alsatimer_user_instance_stop_worker(self);
+    alsatimer_user_instance_set_tick_time_events_handler(self, NULL, NULL, NULL);
+    alsatimer_user_instance_set_real_time_events_handler(self, NULL, NULL, NULL);
+
     if (priv->fd >= 0)
         close(priv->fd);
 
@@ -83,6 +230,87 @@ static void alsatimer_user_instance_class_init(ALSATimerUserInstanceClass *klass
     GObjectClass *gobject_class = G_OBJECT_CLASS(klass);
 
     gobject_class->finalize = timer_user_instance_finalize;
+    gobject_class->set_property = timer_user_instance_set_property;
+    gobject_class->get_property = timer_user_instance_get_property;
+
+    /**
+     * ALSATimerUserInstance:collect-event-statistics:
+     *
+     * Whether to collect statistics of real time events dispatched by the source returned by
+     * [method@UserInstance.create_source] or the thread started by
+     * [method@UserInstance.start_worker]. The statistics are retrieved by
+     * [method@UserInstance.get_event_statistics].
+     *
+     * Since: 0.4.
+     */
+    timer_user_instance_props[TIMER_USER_INSTANCE_PROP_COLLECT_EVENT_STATISTICS] =
+        g_param_spec_boolean("collect-event-statistics", "collect-event-statistics",
+                             "Whether to collect statistics of real time events.",
+                             FALSE,
+                             G_PARAM_READWRITE);
+
+    /**
+     * ALSATimerUserInstance:worker-event-count:
+     *
+     * The number of real time events handled by the thread started by
+     * [method@UserInstance.start_worker]. It is reset at the call of the method.
+     *
+     * Since: 0.4.
+     */
+    timer_user_instance_props[TIMER_USER_INSTANCE_PROP_WORKER_EVENT_COUNT] =
+        g_param_spec_uint64("worker-event-count", "worker-event-count",
+                            "The number of real time events handled by the worker thread.",
+                            0, G_MAXUINT64,
+                            0,
+                            G_PARAM_READABLE);
+
+    /**
+     * ALSATimerUserInstance:worker-min-latency:
+     *
+     * The minimum latency in nanosecond unit between the timestamp of real time event and the
+     * call of handler in the thread started by [method@UserInstance.start_worker].
+     *
+     * Since: 0.4.
+     */
+    timer_user_instance_props[TIMER_USER_INSTANCE_PROP_WORKER_MIN_LATENCY] =
+        g_param_spec_uint64("worker-min-latency", "worker-min-latency",
+                            "The minimum latency in nanosecond unit to call the handler.",
+                            0, G_MAXUINT64,
+                            0,
+                            G_PARAM_READABLE);
+
+    /**
+     * ALSATimerUserInstance:worker-max-latency:
+     *
+     * The maximum latency in nanosecond unit between the timestamp of real time event and the
+     * call of handler in the thread started by [method@UserInstance.start_worker].
+     *
+     * Since: 0.4.
+     */
+    timer_user_instance_props[TIMER_USER_INSTANCE_PROP_WORKER_MAX_LATENCY] =
+        g_param_spec_uint64("worker-max-latency", "worker-max-latency",
+                            "The maximum latency in nanosecond unit to call the handler.",
+                            0, G_MAXUINT64,
+                            0,
+                            G_PARAM_READABLE);
+
+    /**
+     * ALSATimerUserInstance:worker-mean-latency:
+     *
+     * The mean latency in nanosecond unit between the timestamp of real time event and the
+     * call of handler in the thread started by [method@UserInstance.start_worker].
+     *
+     * Since: 0.4.
+     */
+    timer_user_instance_props[TIMER_USER_INSTANCE_PROP_WORKER_MEAN_LATENCY] =
+        g_param_spec_uint64("worker-mean-latency", "worker-mean-latency",
+                            "The mean latency in nanosecond unit to call the handler.",
+                            0, G_MAXUINT64,
+                            0,
+                            G_PARAM_READABLE);
+
+    g_object_class_install_properties(gobject_class, TIMER_USER_INSTANCE_PROP_COUNT,
+                                      timer_user_instance_props);
 
     /**
      * ALSATimerUserInstance::handle-tick-time-event:
@@ -140,6 +368,8 @@ static void alsatimer_user_instance_init(ALSATimerUserInstance *self)
                             alsatimer_user_instance_get_instance_private(self);
 
     priv->fd = -1;
+    priv->tstamp_clock_id = CLOCK_MONOTONIC;
+    priv->prev_tick_tstamp = -1;
 }
 
 /**
@@ -283,6 +513,16 @@ gboolean alsatimer_user_instance_choose_event_type(ALSATimerUserInstance *self,
     }
 
     priv->event_type = event_type;
+
+    // NOTE: The clock for timestamp of real time event is decided by the parameter of snd-timer
+    // module. The default of the parameter is used unless it is available.
+    if (event_type == ALSATIMER_EVENT_TYPE_REAL_TIME) {
+        int clock_id;
+
+        if (alsatimer_get_real_time_clock_id(&clock_id, NULL))
+            priv->tstamp_clock_id = clock_id;
+    }
+
     return TRUE;
 }
 
@@ -415,7 +655,9 @@ gboolean alsatimer_user_instance_get_info(ALSATimerUserInstance *self,
  * Configure the instance with the parameters and return the latest parameters.
  *
  * The call of function executes `ioctl(2)` system call with `SNDRV_TIMER_IOCTL_PARAMS` command
- * for ALSA timer character device.
+ * for ALSA timer character device. Additionally, it executes `ioctl(2)` system call with
+ * `SNDRV_TIMER_IOCTL_INFO` command to compute the interval expected for the statistics of real
+ * time events.
  *
  * Returns: %TRUE when the overall operation finishes successfully, else %FALSE.
  */
@@ -425,6 +667,7 @@ gboolean alsatimer_user_instance_set_params(ALSATimerUserInstance *self,
 {
     ALSATimerUserInstancePrivate *priv;
     struct snd_timer_params *params;
+    struct snd_timer_info info = {0};
 
     g_return_val_if_fail(ALSATIMER_IS_USER_INSTANCE(self), FALSE);
     priv = alsatimer_user_instance_get_instance_private(self);
@@ -442,6 +685,12 @@ gboolean alsatimer_user_instance_set_params(ALSATimerUserInstance *self,
         return FALSE;
     }
 
+    g_atomic_int_set(&priv->interval_ticks, params->ticks);
+
+    // For the statistics of real time events. The failure is not critical.
+    if (ioctl(priv->fd, SNDRV_TIMER_IOCTL_INFO, &info) == 0)
+        g_atomic_int_set(&priv->tick_resolution, (guint)info.resolution);
+
     return TRUE;
 }
 
@@ -496,10 +745,165 @@ static gboolean timer_user_instance_check_src(GSource *gsrc)
     return !!(condition & (G_IO_IN | G_IO_ERR));
 }
 
+/**
+ * alsatimer_user_instance_set_tick_time_events_handler:
+ * @self: A [class@UserInstance].
+ * @handler: (scope notified) (nullable): The function to handle batch of events for tick time.
+ * @user_data: (closure): The data passed to the handler.
+ * @destroy: (destroy user_data) (nullable): The function to release the data.
+ *
+ * Install the function to handle batch of events instead of
+ * [signal@UserInstance::handle-tick-time-event] signal. The function is called once for the
+ * events read at once in the dispatch of source returned by [method@UserInstance.create_source],
+ * with the buffer borrowed from the source, thus it can avoid the overhead of signal emission for
+ * each event. The signal is not emitted while the function is installed. When %NULL is passed to
+ * the handler, the function installed previously is removed and the signal is emitted again.
+ *
+ * The function is also called by the thread started by [method@UserInstance.start_worker], thus
+ * it should not be changed while the thread runs.
+ *
+ * Since: 0.4.
+ */
+void alsatimer_user_instance_set_tick_time_events_handler(ALSATimerUserInstance *self,
+                                        ALSATimerUserInstanceTickTimeEventsHandler handler,
+                                        gpointer user_data, GDestroyNotify destroy)
+{
+    ALSATimerUserInstancePrivate *priv;
+
+    g_return_if_fail(ALSATIMER_IS_USER_INSTANCE(self));
+    priv = alsatimer_user_instance_get_instance_private(self);
+    g_return_if_fail(priv->worker == NULL);
+
+    if (priv->tick_time_events_handler_destroy != NULL)
+        priv->tick_time_events_handler_destroy(priv->tick_time_events_handler_data);
+
+    priv->tick_time_events_handler = handler;
+    priv->tick_time_events_handler_data = handler != NULL ? user_data : NULL;
+    priv->tick_time_events_handler_destroy = handler != NULL ? destroy : NULL;
+}
+
+/**
+ * alsatimer_user_instance_set_real_time_events_handler:
+ * @self: A [class@UserInstance].
+ * @handler: (scope notified) (nullable): The function to handle batch of events for real time.
+ * @user_data: (closure): The data passed to the handler.
+ * @destroy: (destroy user_data) (nullable): The function to release the data.
+ *
+ * Install the function to handle batch of events instead of
+ * [signal@UserInstance::handle-real-time-event] signal. The function is called once for the
+ * events read at once in the dispatch of source returned by [method@UserInstance.create_source],
+ * with the buffer borrowed from the source, thus it can avoid the overhead of signal emission for
+ * each event. The signal is not emitted while the function is installed. When %NULL is passed to
+ * the handler, the function installed previously is removed and the signal is emitted again.
+ *
+ * The function is also called by the thread started by [method@UserInstance.start_worker], thus
+ * it should not be changed while the thread runs.
+ *
+ * Since: 0.4.
+ */
+void alsatimer_user_instance_set_real_time_events_handler(ALSATimerUserInstance *self,
+                                        ALSATimerUserInstanceRealTimeEventsHandler handler,
+                                        gpointer user_data, GDestroyNotify destroy)
+{
+    ALSATimerUserInstancePrivate *priv;
+
+    g_return_if_fail(ALSATIMER_IS_USER_INSTANCE(self));
+    priv = alsatimer_user_instance_get_instance_private(self);
+    g_return_if_fail(priv->worker == NULL);
+
+    if (priv->real_time_events_handler_destroy != NULL)
+        priv->real_time_events_handler_destroy(priv->real_time_events_handler_data);
+
+    priv->real_time_events_handler = handler;
+    priv->real_time_events_handler_data = handler != NULL ? user_data : NULL;
+    priv->real_time_events_handler_destroy = handler != NULL ? destroy : NULL;
+}
+
+static gboolean read_tstamp_clock(ALSATimerUserInstancePrivate *priv, gint64 *now)
+{
+    struct timespec ts;
+
+    if (clock_gettime(priv->tstamp_clock_id, &ts) < 0)
+        return FALSE;
+    *now = (gint64)ts.tv_sec * G_GINT64_CONSTANT(1000000000) + ts.tv_nsec;
+
+    return TRUE;
+}
+
+static void record_event_statistics(ALSATimerUserInstancePrivate *priv,
+                                    const struct snd_timer_tread *events, gsize count)
+{
+    struct timer_event_statistics *stats = &priv->event_statistics;
+    guint64 resolution;
+    gint64 now;
+    gsize i;
+
+    if (count == 0 || !read_tstamp_clock(priv, &now))
+        return;
+
+    resolution = (guint)g_atomic_int_get(&priv->tick_resolution);
+
+    // NOTE: The counters are just incremented atomically so that the statistics can be retrieved
+    // in the other thread without any lock. The timestamp of previous tick event is not atomic,
+    // since events are dispatched by either one source or the worker thread, not both of them.
+    // The reset in the other thread is just requested by the flag.
+    if (g_atomic_int_compare_and_exchange(&priv->prev_tick_tstamp_expired, TRUE, FALSE))
+        priv->prev_tick_tstamp = -1;
+    for (i = 0; i < count; ++i) {
+        const struct snd_timer_tread *ev = events + i;
+        gint64 tstamp = (gint64)ev->tstamp.tv_sec * G_GINT64_CONSTANT(1000000000) +
+                        ev->tstamp.tv_nsec;
+        guint index;
+
+        g_atomic_int_inc(&stats->event_count);
+
+        if (tstamp <= now) {
+            index = timer_event_statistics_bin_index((guint64)(now - tstamp));
+            g_atomic_int_inc(&stats->wakeup_delay_bins[index]);
+        }
+
+        // The interval across the start or stop of timer is not the one of successive ticks.
+        if (ev->event == SNDRV_TIMER_EVENT_START || ev->event == SNDRV_TIMER_EVENT_STOP ||
+            ev->event == SNDRV_TIMER_EVENT_CONTINUE) {
+            priv->prev_tick_tstamp = -1;
+            continue;
+        }
+
+        if (ev->event != SNDRV_TIMER_EVENT_TICK)
+            continue;
+        g_atomic_int_inc(&stats->tick_count);
+
+        // NOTE: The value of tick event is the number of ticks elapsed since the previous tick
+        // event. It is larger than the interval when the former events were merged.
+        if (priv->prev_tick_tstamp >= 0 && ev->val > 0 && resolution > 0 &&
+            tstamp >= priv->prev_tick_tstamp) {
+            guint64 expected = (guint64)ev->val * resolution;
+            guint64 interval = (guint64)(tstamp - priv->prev_tick_tstamp);
+            guint64 deviation = interval > expected ? interval - expected : expected - interval;
+
+            index = timer_event_statistics_bin_index(deviation);
+            g_atomic_int_inc(&stats->interval_deviation_bins[index]);
+        }
+        priv->prev_tick_tstamp = tstamp;
+    }
+}
+
 static void dispatch_tick_time_events(ALSATimerUserInstance *self, const guint8 *buf, gsize length)
 {
+    ALSATimerUserInstancePrivate *priv = alsatimer_user_instance_get_instance_private(self);
     const struct snd_timer_read *ev;
 
+    // NOTE: The installed handler has precedence over the signal to skip marshalling.
+    if (priv->tick_time_events_handler != NULL) {
+        gsize count = length / sizeof(*ev);
+
+        if (count > 0) {
+            priv->tick_time_events_handler(self, (const ALSATimerTickTimeEvent *)buf, count,
+                                           priv->tick_time_events_handler_data);
+        }
+        return;
+    }
+
     while (length >= sizeof(*ev)) {
         ev = (const struct snd_timer_read *)buf;
 
@@ -514,8 +918,23 @@ static void dispatch_tick_time_events(ALSATimerUserInstance *self, const guint8
 
 static void dispatch_real_time_events(ALSATimerUserInstance *self, const guint8 *buf, gsize length)
 {
+    ALSATimerUserInstancePrivate *priv = alsatimer_user_instance_get_instance_private(self);
     const struct snd_timer_tread *ev;
 
+    if (g_atomic_int_get(&priv->collect_event_statistics))
+        record_event_statistics(priv, (const struct snd_timer_tread *)buf, length / sizeof(*ev));
+
+    // NOTE: The installed handler has precedence over the signal to skip marshalling.
+    if (priv->real_time_events_handler != NULL) {
+        gsize count = length / sizeof(*ev);
+
+        if (count > 0) {
+            priv->real_time_events_handler(self, (const ALSATimerRealTimeEvent *)buf, count,
+                                           priv->real_time_events_handler_data);
+        }
+        return;
+    }
+
     while (length >= sizeof(*ev)) {
         const struct snd_timer_tread *ev = (const struct snd_timer_tread *)buf;
 
@@ -592,6 +1011,10 @@ static void timer_user_instance_finalize_src(GSource *gsrc)
  * [signal@UserInstance::handle-real-time-event] signals, according to the result of `poll(2)`
  * system call.
  *
+ * Just one source should be attached at a time when
+ * [property@UserInstance:collect-event-statistics] is enabled, since the statistics are collected
+ * by a single dispatcher.
+ *
  * Returns: %TRUE when the overall operation finishes successfully, else %FALSE.
  */
 gboolean alsatimer_user_instance_create_source(ALSATimerUserInstance *self, GSource **gsrc,
@@ -758,3 +1181,441 @@ gboolean alsatimer_user_instance_continue(ALSATimerUserInstance *self, GError **
 
     return TRUE;
 }
+
+static void update_latency_stats(ALSATimerUserInstancePrivate *priv,
+                                 const struct snd_timer_tread *events, gsize count)
+{
+    struct timer_latency_stats *stats = &priv->latency_stats;
+    guint64 total = 0;
+    guint64 min = G_MAXUINT64;
+    guint64 max = 0;
+    guint64 measured = 0;
+    gint64 now;
+    gsize i;
+
+    if (!read_tstamp_clock(priv, &now))
+        return;
+
+    for (i = 0; i < count; ++i) {
+        gint64 tstamp = (gint64)events[i].tstamp.tv_sec * G_GINT64_CONSTANT(1000000000) +
+                        events[i].tstamp.tv_nsec;
+        guint64 latency;
+
+        // The timestamp in the other clock is not comparable.
+        if (tstamp > now)
+            continue;
+        latency = (guint64)(now - tstamp);
+
+        min = MIN(min, latency);
+        max = MAX(max, latency);
+        total += latency;
+        ++measured;
+    }
+
+    if (measured == 0)
+        return;
+
+    g_atomic_int_inc(&stats->seq);
+    if (stats->count == 0 || min < stats->min)
+        stats->min = min;
+    if (max > stats->max)
+        stats->max = max;
+    stats->total += total;
+    stats->count += measured;
+    g_atomic_int_inc(&stats->seq);
+}
+
+static int apply_worker_sched(struct timer_worker *worker)
+{
+    if (worker->cpu_count > 0) {
+        cpu_set_t cpu_set;
+        gsize i;
+
+        CPU_ZERO(&cpu_set);
+        for (i = 0; i < worker->cpu_count; ++i) {
+            if (worker->cpus[i] >= CPU_SETSIZE) {
+                worker->sched_call = "sched_setaffinity";
+                return EINVAL;
+            }
+            CPU_SET(worker->cpus[i], &cpu_set);
+        }
+
+        // The zero as pid means the calling thread.
+        if (sched_setaffinity(0, sizeof(cpu_set), &cpu_set) < 0) {
+            worker->sched_call = "sched_setaffinity";
+            return errno;
+        }
+    }
+
+    if (worker->priority > 0) {
+        struct sched_param param = { .sched_priority = worker->priority };
+        int err;
+
+        err = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+        if (err != 0) {
+            worker->sched_call = "pthread_setschedparam";
+            return err;
+        }
+    }
+
+    return 0;
+}
+
+static gboolean timer_user_instance_handle_worker_disconnection(gpointer data)
+{
+    ALSATimerUserInstance *self = data;
+    ALSATimerUserInstancePrivate *priv = alsatimer_user_instance_get_instance_private(self);
+
+    // NOTE: The worker can be already stopped and the other worker can be started.
+    if (priv->worker != NULL && g_atomic_int_get(&priv->worker->disconnected))
+        alsatimer_user_instance_stop_worker(self);
+
+    g_signal_emit(self, timer_user_instance_sigs[TIMER_USER_INSTANCE_SIG_HANDLE_DISCONNECTION],
+                  0, NULL);
+
+    return G_SOURCE_REMOVE;
+}
+
+static gpointer timer_user_instance_run_worker(gpointer data)
+{
+    struct timer_worker *worker = data;
+    ALSATimerUserInstance *self = worker->self;
+    ALSATimerUserInstancePrivate *priv = alsatimer_user_instance_get_instance_private(self);
+    GSource *src;
+    int err;
+
+    err = apply_worker_sched(worker);
+
+    g_mutex_lock(&worker->mutex);
+    worker->sched_err = err;
+    worker->started = TRUE;
+    g_cond_signal(&worker->cond);
+    g_mutex_unlock(&worker->mutex);
+
+    if (err != 0)
+        return NULL;
+
+    while (TRUE) {
+        struct pollfd pfds[2] = {
+            { .fd = worker->fd, .events = POLLIN, },
+            { .fd = worker->stop_fd, .events = POLLIN, },
+        };
+        ssize_t len;
+
+        if (poll(pfds, G_N_ELEMENTS(pfds), -1) < 0) {
+            if (errno == EINTR)
+                continue;
+            break;
+        }
+
+        if (pfds[1].revents != 0)
+            return NULL;
+
+        // The timer device is not available anymore.
+        if (pfds[0].revents & (POLLERR | POLLHUP | POLLNVAL))
+            break;
+
+        if (!(pfds[0].revents & POLLIN))
+            continue;
+
+        len = read(worker->fd, worker->buf, worker->buf_len);
+        if (len < 0) {
+            if (errno == EAGAIN || errno == EINTR)
+                continue;
+            break;
+        }
+
+        switch (worker->event_type) {
+        case ALSATIMER_EVENT_TYPE_TICK_TIME:
+            dispatch_tick_time_events(self, worker->buf, (gsize)len);
+            break;
+        case ALSATIMER_EVENT_TYPE_REAL_TIME:
+        {
+            gsize count = (gsize)len / sizeof(struct snd_timer_tread);
+
+            update_latency_stats(priv, (const struct snd_timer_tread *)worker->buf, count);
+            dispatch_real_time_events(self, worker->buf, (gsize)len);
+            break;
+        }
+        default:
+            break;
+        }
+    }
+
+    // NOTE: The signal is emitted and the thread is joined in the main context, since the thread
+    // can not join itself. The source keeps the instance till it is dispatched.
+    g_atomic_int_set(&worker->disconnected, TRUE);
+    src = g_idle_source_new();
+    g_source_set_callback(src, timer_user_instance_handle_worker_disconnection,
+                          g_object_ref(self), g_object_unref);
+    g_source_attach(src, worker->context);
+    g_source_unref(src);
+
+    return NULL;
+}
+
+static void timer_worker_free(struct timer_worker *worker)
+{
+    if (worker->context != NULL)
+        g_main_context_unref(worker->context);
+    if (worker->stop_fd >= 0)
+        close(worker->stop_fd);
+    g_free(worker->cpus);
+    g_free(worker->buf);
+    g_mutex_clear(&worker->mutex);
+    g_cond_clear(&worker->cond);
+    g_free(worker);
+}
+
+/**
+ * alsatimer_user_instance_start_worker:
+ * @self: A [class@UserInstance].
+ * @priority: The priority of `SCHED_FIFO` scheduling policy for the thread. When zero, the thread
+ *            runs with the default scheduling policy.
+ * @cpus: (array length=cpu_count) (nullable): The array of numeric identifiers of CPU on which
+ *        the thread runs.
+ * @cpu_count: The number of elements in the array. When zero, the affinity of thread is not
+ *             changed.
+ * @error: A [struct@GLib.Error]. Error is generated with domain of `ALSATimer.UserInstanceError`.
+ *
+ * Start a thread to read events from ALSA timer character device. The thread blocks in the
+ * `poll(2)` system call, then executes `read(2)` system call and calls the function installed by
+ * [method@UserInstance.set_tick_time_events_handler] or
+ * [method@UserInstance.set_real_time_events_handler] according to the type of event chosen by
+ * [method@UserInstance.choose_event_type]. The function for the type of event should be installed
+ * in advance. The signals are not emitted by the thread.
+ *
+ * For real time events, the latency between the timestamp of event and the call of function is
+ * measured in the clock reported by [func@get_real_time_clock_id], then reported by
+ * [property@UserInstance:worker-event-count], [property@UserInstance:worker-min-latency],
+ * [property@UserInstance:worker-max-latency], and [property@UserInstance:worker-mean-latency]. The
+ * statistics are reset by the call.
+ *
+ * The thread has a reference to the instance till [method@UserInstance.stop_worker] is called.
+ * When the timer device is not available anymore, the thread stops by itself. Then
+ * [signal@UserInstance::handle-disconnection] is emitted by the idle source in the thread-default
+ * [struct@GLib.MainContext] of the caller, and the reference is released. The source returned by
+ * [method@UserInstance.create_source] should not be used together.
+ *
+ * Returns: %TRUE when the overall operation finishes successfully, else %FALSE.
+ *
+ * Since: 0.4.
+ */
+gboolean alsatimer_user_instance_start_worker(ALSATimerUserInstance *self, gint priority,
+                                              const guint *cpus, gsize cpu_count, GError **error)
+{
+    ALSATimerUserInstancePrivate *priv;
+    struct timer_worker *worker;
+
+    g_return_val_if_fail(ALSATIMER_IS_USER_INSTANCE(self), FALSE);
+    priv = alsatimer_user_instance_get_instance_private(self);
+    g_return_val_if_fail(priv->fd >= 0, FALSE);
+    g_return_val_if_fail(priv->worker == NULL, FALSE);
+    g_return_val_if_fail(priv->event_type != ALSATIMER_EVENT_TYPE_TICK_TIME ||
+                         priv->tick_time_events_handler != NULL, FALSE);
+    g_return_val_if_fail(priv->event_type != ALSATIMER_EVENT_TYPE_REAL_TIME ||
+                         priv->real_time_events_handler != NULL, FALSE);
+
+    g_return_val_if_fail(priority >= 0, FALSE);
+    g_return_val_if_fail(cpus != NULL || cpu_count == 0, FALSE);
+    g_return_val_if_fail(error == NULL || *error == NULL, FALSE);
+
+    worker = g_malloc0(sizeof(*worker));
+    worker->self = self;
+    worker->context = g_main_context_ref_thread_default();
+    worker->fd = priv->fd;
+    worker->stop_fd = -1;
+    worker->event_type = priv->event_type;
+    worker->priority = priority;
+    g_mutex_init(&worker->mutex);
+    g_cond_init(&worker->cond);
+
+    if (cpu_count > 0) {
+        worker->cpus = g_malloc_n(cpu_count, sizeof(*cpus));
+        memcpy(worker->cpus, cpus, cpu_count * sizeof(*cpus));
+        worker->cpu_count = cpu_count;
+    }
+
+    worker->buf_len = sysconf(_SC_PAGESIZE);
+    worker->buf = g_malloc0(worker->buf_len);
+
+    worker->stop_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (worker->stop_fd < 0) {
+        generate_syscall_error(error, errno, "eventfd(%s)", "stop");
+        timer_worker_free(worker);
+        return FALSE;
+    }
+
+    // NOTE: No worker thread runs at present, thus the call is the only writer.
+    g_atomic_int_inc(&priv->latency_stats.seq);
+    priv->latency_stats.count = 0;
+    priv->latency_stats.min = 0;
+    priv->latency_stats.max = 0;
+    priv->latency_stats.total = 0;
+    g_atomic_int_inc(&priv->latency_stats.seq);
+
+    worker->thread = g_thread_try_new("ALSATimerUserInstance", timer_user_instance_run_worker,
+                                      worker, error);
+    if (worker->thread == NULL) {
+        timer_worker_free(worker);
+        return FALSE;
+    }
+
+    g_mutex_lock(&worker->mutex);
+    while (!worker->started)
+        g_cond_wait(&worker->cond, &worker->mutex);
+    g_mutex_unlock(&worker->mutex);
+
+    if (worker->sched_err != 0) {
+        generate_syscall_error(error, worker->sched_err, "%s(2)", worker->sched_call);
+        g_thread_join(worker->thread);
+        timer_worker_free(worker);
+        return FALSE;
+    }
+
+    // NOTE: The thread refers to the instance till it is stopped, thus the instance is not
+    // finalized by the last reference released in the handler of events in the thread.
+    g_object_ref(self);
+    priv->worker = worker;
+
+    return TRUE;
+}
+
+/**
+ * alsatimer_user_instance_stop_worker:
+ * @self: A [class@UserInstance].
+ *
+ * Stop the thread started by the call of [method@UserInstance.start_worker] and release the
+ * reference to the instance which the thread has. The statistics of latency are kept till the next
+ * call of the method.
+ *
+ * The method should not be called by the handler of events in the thread.
+ *
+ * Since: 0.4.
+ */
+void alsatimer_user_instance_stop_worker(ALSATimerUserInstance *self)
+{
+    ALSATimerUserInstancePrivate *priv;
+    struct timer_worker *worker;
+    guint64 val = 1;
+
+    g_return_if_fail(ALSATIMER_IS_USER_INSTANCE(self));
+    priv = alsatimer_user_instance_get_instance_private(self);
+
+    worker = priv->worker;
+    if (worker == NULL)
+        return;
+
+    // The thread can not join itself.
+    g_return_if_fail(g_thread_self() != worker->thread);
+
+    if (write(worker->stop_fd, &val, sizeof(val)) < 0)
+        g_warn_if_reached();
+    g_thread_join(worker->thread);
+
+    // The handlers can be changed after the thread finishes.
+    priv->worker = NULL;
+
+    timer_worker_free(worker);
+
+    // NOTE: The caller or the source for disconnection still has the reference.
+    g_object_unref(self);
+}
+
+/**
+ * alsatimer_user_instance_get_event_statistics:
+ * @self: A [class@UserInstance].
+ * @event_statistics: (inout): A [class@EventStatistics].
+ * @error: A [struct@GLib.Error]. Error is generated with domain of `ALSATimer.UserInstanceError`.
+ *
+ * Get the snapshot of statistics of real time events collected while
+ * [property@UserInstance:collect-event-statistics] is enabled. The statistics are retrieved
+ * without blocking the dispatch of events, thus the counters in the snapshot can be slightly
+ * inconsistent each other when events are dispatched in the other thread.
+ *
+ * The call of function executes `ioctl(2)` system call with `SNDRV_TIMER_IOCTL_STATUS` command
+ * for ALSA timer character device to retrieve the count of overrun and lost ticks.
+ *
+ * Returns: %TRUE when the overall operation finishes successfully, else %FALSE.
+ *
+ * Since: 0.4.
+ */
+gboolean alsatimer_user_instance_get_event_statistics(ALSATimerUserInstance *self,
+                                        ALSATimerEventStatistics *const *event_statistics,
+                                        GError **error)
+{
+    ALSATimerUserInstancePrivate *priv;
+    struct timer_event_statistics *src;
+    struct timer_event_statistics *dst;
+    struct snd_timer_status status = {0};
+    guint *overrun;
+    guint *lost;
+    int i;
+
+    g_return_val_if_fail(ALSATIMER_IS_USER_INSTANCE(self), FALSE);
+    priv = alsatimer_user_instance_get_instance_private(self);
+
+    g_return_val_if_fail(event_statistics != NULL, FALSE);
+    g_return_val_if_fail(error == NULL || *error == NULL, FALSE);
+
+    g_return_val_if_fail(ALSATIMER_IS_EVENT_STATISTICS(*event_statistics), FALSE);
+    timer_event_statistics_refer_private(*event_statistics, &dst, &overrun, &lost);
+
+    if (ioctl(priv->fd, SNDRV_TIMER_IOCTL_STATUS, &status) < 0) {
+        if (errno == EBADFD)
+            generate_local_error(error, ALSATIMER_USER_INSTANCE_ERROR_NOT_ATTACHED);
+        else
+            generate_syscall_error(error, errno, "ioctl(%s)", "STATUS");
+        return FALSE;
+    }
+
+    src = &priv->event_statistics;
+    dst->event_count = (guint)g_atomic_int_get(&src->event_count);
+    dst->tick_count = (guint)g_atomic_int_get(&src->tick_count);
+    dst->expected_interval = (guint64)g_atomic_int_get(&priv->interval_ticks) *
+                             (guint)g_atomic_int_get(&priv->tick_resolution);
+    for (i = 0; i < TIMER_EVENT_STATISTICS_BIN_COUNT; ++i) {
+        dst->interval_deviation_bins[i] = (guint)g_atomic_int_get(&src->interval_deviation_bins[i]);
+        dst->wakeup_delay_bins[i] = (guint)g_atomic_int_get(&src->wakeup_delay_bins[i]);
+    }
+
+    *overrun = status.overrun;
+    *lost = status.lost;
+
+    return TRUE;
+}
+
+/**
+ * alsatimer_user_instance_reset_event_statistics:
+ * @self: A [class@UserInstance].
+ *
+ * Reset the statistics of real time events. The interval is measured again since the next tick
+ * event.
+ *
+ * Since: 0.4.
+ */
+void alsatimer_user_instance_reset_event_statistics(ALSATimerUserInstance *self)
+{
+    ALSATimerUserInstancePrivate *priv;
+    struct timer_event_statistics *stats;
+    int i;
+
+    g_return_if_fail(ALSATIMER_IS_USER_INSTANCE(self));
+    priv = alsatimer_user_instance_get_instance_private(self);
+
+    stats = &priv->event_statistics;
+    g_atomic_int_set(&stats->event_count, 0);
+    g_atomic_int_set(&stats->tick_count, 0);
+    for (i = 0; i < TIMER_EVENT_STATISTICS_BIN_COUNT; ++i) {
+        g_atomic_int_set(&stats->interval_deviation_bins[i], 0);
+        g_atomic_int_set(&stats->wakeup_delay_bins[i], 0);
+    }
+    g_atomic_int_set(&priv->prev_tick_tstamp_expired, TRUE);
+}
+
+guint timer_user_instance_get_interval_ticks(ALSATimerUserInstance *self)
+{
+    ALSATimerUserInstancePrivate *priv = alsatimer_user_instance_get_instance_private(self);
+
+    return (guint)g_atomic_int_get(&priv->interval_ticks);
+}
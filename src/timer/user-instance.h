@@ -15,6 +15,36 @@ G_DECLARE_DERIVABLE_TYPE(ALSATimerUserInstance, alsatimer_user_instance, ALSATIM
 
 GQuark alsatimer_user_instance_error_quark();
 
+/**
+ * ALSATimerUserInstanceTickTimeEventsHandler:
+ * @self: A [class@UserInstance].
+ * @events: (array length=event_count)(transfer none): The array of [struct@TickTimeEvent].
+ * @event_count: The number of events in the array.
+ * @user_data: The data passed to [method@UserInstance.set_tick_time_events_handler].
+ *
+ * The type of function to handle batch of events for tick time. The array is borrowed from the
+ * source, thus it is not available after the function returns.
+ */
+typedef void (*ALSATimerUserInstanceTickTimeEventsHandler)(ALSATimerUserInstance *self,
+                                                           const ALSATimerTickTimeEvent *events,
+                                                           gsize event_count,
+                                                           gpointer user_data);
+
+/**
+ * ALSATimerUserInstanceRealTimeEventsHandler:
+ * @self: A [class@UserInstance].
+ * @events: (array length=event_count)(transfer none): The array of [struct@RealTimeEvent].
+ * @event_count: The number of events in the array.
+ * @user_data: The data passed to [method@UserInstance.set_real_time_events_handler].
+ *
+ * The type of function to handle batch of events for real time. The array is borrowed from the
+ * source, thus it is not available after the function returns.
+ */
+typedef void (*ALSATimerUserInstanceRealTimeEventsHandler)(ALSATimerUserInstance *self,
+                                                           const ALSATimerRealTimeEvent *events,
+                                                           gsize event_count,
+                                                           gpointer user_data);
+
 struct _ALSATimerUserInstanceClass {
     GObjectClass parent_class;
 
@@ -81,6 +111,22 @@ gboolean alsatimer_user_instance_get_status(ALSATimerUserInstance *self,
 gboolean alsatimer_user_instance_create_source(ALSATimerUserInstance *self, GSource **gsrc,
                                                GError **error);
 
+void alsatimer_user_instance_set_tick_time_events_handler(ALSATimerUserInstance *self,
+                                        ALSATimerUserInstanceTickTimeEventsHandler handler,
+                                        gpointer user_data, GDestroyNotify destroy);
+void alsatimer_user_instance_set_real_time_events_handler(ALSATimerUserInstance *self,
+                                        ALSATimerUserInstanceRealTimeEventsHandler handler,
+                                        gpointer user_data, GDestroyNotify destroy);
+
+gboolean alsatimer_user_instance_start_worker(ALSATimerUserInstance *self, gint priority,
+                                              const guint *cpus, gsize cpu_count, GError **error);
+void alsatimer_user_instance_stop_worker(ALSATimerUserInstance *self);
+
+gboolean alsatimer_user_instance_get_event_statistics(ALSATimerUserInstance *self,
+                                        ALSATimerEventStatistics *const *event_statistics,
+                                        GError **error);
+void alsatimer_user_instance_reset_event_statistics(ALSATimerUserInstance *self);
+
 gboolean alsatimer_user_instance_start(ALSATimerUserInstance *self, GError **error);
 
 gboolean alsatimer_user_instance_stop(ALSATimerUserInstance *self, GError **error);